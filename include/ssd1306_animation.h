@@ -0,0 +1,41 @@
+#ifndef SSD1306_ANIMATION_H
+#define SSD1306_ANIMATION_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "freertos/FreeRTOS.h"
+#include "esp_err.h"
+#include "ssd1306_oled.h"
+
+
+// struct for playing a delta encoded animation ( see ssd1306_bitmap_codec.h ) in a region of a view.
+typedef struct
+{
+    oled_buffer *view;
+    const uint8_t *data;                // referenced, keep it in flash ( const )
+    size_t size;
+    uint16_t width;                     // size of the frames
+    uint8_t pages;
+    uint16_t frame_count;
+    int32_t col;                        // position of the frames in the view, page aligned
+    int32_t page;
+    TickType_t period;                  // ticks between two frames
+    uint16_t next_delta;                // delta the next step applies, frame_count is the looping one
+    size_t next_offset;                 // position of its size in data
+    size_t loop_offset;                 // position of the size of delta 1, where a loop continues
+} oled_animation;
+
+
+
+oled_animation *ssd1306_create_oled_animation(oled_buffer *oled_user_buffer, const uint8_t *data, size_t size, int32_t col, int32_t page, uint32_t fps);
+
+void ssd1306_delete_oled_animation(oled_animation *animation);
+
+void ssd1306_rewind_oled_animation(oled_animation *animation);
+
+esp_err_t ssd1306_step_oled_animation(oled_animation *animation);
+
+esp_err_t ssd1306_play_oled_animation(oled_animation *animation, uint32_t loops);
+
+
+#endif
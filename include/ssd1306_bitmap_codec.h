@@ -0,0 +1,70 @@
+#ifndef SSD1306_BITMAP_CODEC_H
+#define SSD1306_BITMAP_CODEC_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Packed bitmap format, for page-major ( vertical 1 byte mode ) bitmaps.
+//
+// header: width ( 2 bytes, little endian ), pages ( 1 byte ), then tokens producing the
+// width * pages bytes of the bitmap in order, the top page row first.
+//
+//   00nnnnnn                  n + 1 zero bytes
+//   01nnnnnn b                n + 2 copies of byte b
+//   10nnnnnn b0 .. bn         n + 1 literal bytes
+//   11nnnnnn d                n + 3 bytes copied from d + 1 bytes back ( overlapping copies repeat )
+//
+// back references reach at most OLED_PACKED_WINDOW bytes back, so a decoder keeps only that
+// much history and writes everything else straight to its destination.
+
+#define OLED_PACKED_HEADER          3
+#define OLED_PACKED_WINDOW          256
+
+#define OLED_PACKED_ZERO            0x00
+#define OLED_PACKED_FILL            0x40
+#define OLED_PACKED_LITERAL         0x80
+#define OLED_PACKED_COPY            0xC0
+
+// Frame delta format, the change from one page-major frame to the next.
+//
+//   0nnnnnnn                  n + 1 bytes unchanged
+//   1nnnnnnn x0 .. xn         n + 1 bytes XORed with x0 .. xn
+//
+// the bytes after the last token are unchanged.
+//
+// an animation is a header: width ( 2 bytes, little endian ), pages ( 1 byte ), frame count ( 2 bytes,
+// little endian ), followed by frame count + 1 deltas, each one prefixed by its size ( 2 bytes, little
+// endian ). the first delta draws frame 0 over a blank area, the last one turns the last frame back
+// into frame 0 for looping.
+
+#define OLED_DELTA_SKIP             0x00
+#define OLED_DELTA_XOR              0x80
+
+#define OLED_ANIMATION_HEADER       5
+
+
+// box of the destination bytes changed by a delta, empty when col_start > col_end.
+typedef struct
+{
+    int32_t col_start;
+    int32_t col_end;
+    int32_t page_start;
+    int32_t page_end;
+} oled_delta_area;
+
+
+
+size_t ssd1306_pack_oled_bitmap(const uint8_t *bitmap, uint16_t width, uint8_t pages, uint8_t *packed, size_t size);
+
+int ssd1306_read_packed_oled_header(const uint8_t *packed, size_t size, uint16_t *width, uint8_t *pages);
+
+int ssd1306_unpack_oled_bitmap(const uint8_t *packed, size_t size, uint8_t *dst, uint16_t dst_width, uint8_t dst_pages, int32_t col, int32_t page);
+
+size_t ssd1306_pack_oled_delta(const uint8_t *previous, const uint8_t *frame, uint32_t length, uint8_t *delta, size_t size);
+
+int ssd1306_apply_oled_delta(const uint8_t *delta, size_t size, uint16_t width, uint8_t pages, uint8_t *dst, uint16_t dst_width, uint8_t dst_pages, int32_t col, int32_t page, oled_delta_area *changed);
+
+size_t ssd1306_pack_oled_animation(const uint8_t *frames, uint16_t frame_count, uint16_t width, uint8_t pages, uint8_t *packed, size_t size);
+
+
+#endif
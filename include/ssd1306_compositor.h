@@ -0,0 +1,56 @@
+#ifndef SSD1306_COMPOSITOR_H
+#define SSD1306_COMPOSITOR_H
+
+#include <stdint.h>
+#include "esp_err.h"
+#include "ssd1306_oled.h"
+
+#define OLED_MAX_LAYERS             8
+
+
+// enum for how a layer is combined with the layers below it.
+typedef enum
+{
+    BLEND_OPAQUE,                       // the layer replaces everything below its area
+    BLEND_TRANSPARENT                   // only the lit pixels of the layer are drawn
+} blend_mode;
+
+
+// struct for a view placed in the compositor.
+typedef struct
+{
+    oled_buffer *view;
+    int8_t z;                           // higher z is drawn on top
+    blend_mode blend;
+    uint8_t placed;                     // set once the layer is in the frame
+    uint16_t col_pos;                   // position the layer was last composited at
+    uint8_t page_pos;
+} oled_layer;
+
+
+// struct for compositing several views into one full screen frame.
+typedef struct
+{
+    oled_buffer *frame;                 // 128 x 8 page frame, flushed with FLUSH_DIFF
+    oled_layer layers[OLED_MAX_LAYERS]; // sorted by z, back to front
+    uint8_t layer_count;
+} oled_compositor;
+
+
+
+oled_compositor *ssd1306_create_compositor(void);
+
+void ssd1306_delete_compositor(oled_compositor *compositor);
+
+esp_err_t ssd1306_compositor_add_view(oled_compositor *compositor, oled_buffer *view, int8_t z, blend_mode blend);
+
+void ssd1306_compositor_remove_view(oled_compositor *compositor, oled_buffer *view);
+
+void ssd1306_compositor_set_z(oled_compositor *compositor, oled_buffer *view, int8_t z);
+
+void ssd1306_compose_oled_frame(oled_compositor *compositor);
+
+void ssd1306_send_oled_compositor(oled_compositor *compositor);
+
+
+#endif
@@ -2,6 +2,7 @@
 #define FONT_5X7
 
 #include<stdint.h>
+#include "ssd1306_oled.h"
 
 
 const uint8_t font_5x7[][5] = {
@@ -98,4 +99,180 @@ const uint8_t font_5x7[][5] = {
     {0x44,0x64,0x54,0x4C,0x44}  // z (0x7A)
 };
 
-#endif 
+// proportional version of font_5x7: the same glyphs with their empty columns removed,
+// use it with ssd1306_set_oled_font_glyphs( font, font_5x7_prop_glyphs, 91 ) on
+// ssd1306_init_oled_font( font_5x7_prop, 5, 8, 32 ).
+
+const uint8_t font_5x7_prop[407] = {
+    0x5F,0x07,0x00,0x07,0x14,0x7F,0x14,0x7F,0x14,0x24,0x2A,0x7F,
+    0x2A,0x12,0x23,0x13,0x08,0x64,0x62,0x36,0x49,0x55,0x22,0x50,
+    0x05,0x03,0x1C,0x22,0x41,0x41,0x22,0x1C,0x14,0x08,0x3E,0x08,
+    0x14,0x08,0x08,0x3E,0x08,0x08,0x50,0x30,0x08,0x08,0x08,0x08,
+    0x08,0x60,0x60,0x20,0x10,0x08,0x04,0x02,0x3E,0x51,0x49,0x45,
+    0x3E,0x42,0x7F,0x40,0x42,0x61,0x51,0x49,0x46,0x21,0x41,0x45,
+    0x4B,0x31,0x18,0x14,0x12,0x7F,0x10,0x27,0x45,0x45,0x45,0x39,
+    0x3C,0x4A,0x49,0x49,0x30,0x01,0x71,0x09,0x05,0x03,0x36,0x49,
+    0x49,0x49,0x36,0x06,0x49,0x49,0x29,0x1E,0x36,0x36,0x56,0x36,
+    0x08,0x14,0x22,0x41,0x14,0x14,0x14,0x14,0x14,0x41,0x22,0x14,
+    0x08,0x02,0x01,0x51,0x09,0x06,0x32,0x49,0x79,0x41,0x3E,0x7E,
+    0x11,0x11,0x11,0x7E,0x7F,0x49,0x49,0x49,0x36,0x3E,0x41,0x41,
+    0x41,0x22,0x7F,0x41,0x41,0x22,0x1C,0x7F,0x49,0x49,0x49,0x41,
+    0x7F,0x09,0x09,0x09,0x01,0x3E,0x41,0x49,0x49,0x7A,0x7F,0x08,
+    0x08,0x08,0x7F,0x41,0x7F,0x41,0x20,0x40,0x41,0x3F,0x01,0x7F,
+    0x08,0x14,0x22,0x41,0x7F,0x40,0x40,0x40,0x40,0x7F,0x02,0x0C,
+    0x02,0x7F,0x7F,0x04,0x08,0x10,0x7F,0x3E,0x41,0x41,0x41,0x3E,
+    0x7F,0x09,0x09,0x09,0x06,0x3E,0x41,0x51,0x21,0x5E,0x7F,0x09,
+    0x19,0x29,0x46,0x46,0x49,0x49,0x49,0x31,0x01,0x01,0x7F,0x01,
+    0x01,0x3F,0x40,0x40,0x40,0x3F,0x1F,0x20,0x40,0x20,0x1F,0x3F,
+    0x40,0x38,0x40,0x3F,0x63,0x14,0x08,0x14,0x63,0x07,0x08,0x70,
+    0x08,0x07,0x61,0x51,0x49,0x45,0x43,0x7F,0x41,0x41,0x02,0x04,
+    0x08,0x10,0x20,0x41,0x41,0x7F,0x04,0x02,0x01,0x02,0x04,0x40,
+    0x40,0x40,0x40,0x40,0x01,0x02,0x04,0x20,0x54,0x54,0x54,0x78,
+    0x7F,0x48,0x44,0x44,0x38,0x38,0x44,0x44,0x44,0x20,0x38,0x44,
+    0x44,0x48,0x7F,0x38,0x54,0x54,0x54,0x18,0x08,0x7E,0x09,0x01,
+    0x02,0x0C,0x52,0x52,0x52,0x3E,0x7F,0x08,0x04,0x04,0x78,0x44,
+    0x7D,0x40,0x20,0x40,0x44,0x3D,0x7F,0x10,0x28,0x44,0x41,0x7F,
+    0x40,0x7C,0x04,0x18,0x04,0x78,0x7C,0x08,0x04,0x04,0x78,0x38,
+    0x44,0x44,0x44,0x38,0x7C,0x14,0x14,0x14,0x08,0x08,0x14,0x14,
+    0x18,0x7C,0x7C,0x08,0x04,0x04,0x08,0x48,0x54,0x54,0x54,0x20,
+    0x04,0x3F,0x44,0x40,0x20,0x3C,0x40,0x40,0x20,0x7C,0x1C,0x20,
+    0x40,0x20,0x1C,0x3C,0x40,0x30,0x40,0x3C,0x44,0x28,0x10,0x28,
+    0x44,0x0C,0x50,0x50,0x50,0x3C,0x44,0x64,0x54,0x4C,0x44
+};
+
+// { bitmap_offset, width, advance, x_offset }
+const font_glyph font_5x7_prop_glyphs[91] = {
+    {  0, 0, 3, 0}, // 0x20 ' '
+    {  0, 1, 2, 0}, // 0x21 '!'
+    {  1, 3, 4, 0}, // 0x22 '"'
+    {  4, 5, 6, 0}, // 0x23 '#'
+    {  9, 5, 6, 0}, // 0x24 '$'
+    { 14, 5, 6, 0}, // 0x25 '%'
+    { 19, 5, 6, 0}, // 0x26 '&'
+    { 24, 2, 3, 0}, // 0x27 '''
+    { 26, 3, 4, 0}, // 0x28 '('
+    { 29, 3, 4, 0}, // 0x29 ')'
+    { 32, 5, 6, 0}, // 0x2A '*'
+    { 37, 5, 6, 0}, // 0x2B '+'
+    { 42, 2, 3, 0}, // 0x2C ','
+    { 44, 5, 6, 0}, // 0x2D '-'
+    { 49, 2, 3, 0}, // 0x2E '.'
+    { 51, 5, 6, 0}, // 0x2F '/'
+    { 56, 5, 6, 0}, // 0x30 '0'
+    { 61, 3, 4, 0}, // 0x31 '1'
+    { 64, 5, 6, 0}, // 0x32 '2'
+    { 69, 5, 6, 0}, // 0x33 '3'
+    { 74, 5, 6, 0}, // 0x34 '4'
+    { 79, 5, 6, 0}, // 0x35 '5'
+    { 84, 5, 6, 0}, // 0x36 '6'
+    { 89, 5, 6, 0}, // 0x37 '7'
+    { 94, 5, 6, 0}, // 0x38 '8'
+    { 99, 5, 6, 0}, // 0x39 '9'
+    {104, 2, 3, 0}, // 0x3A ':'
+    {106, 2, 3, 0}, // 0x3B ';'
+    {108, 4, 5, 0}, // 0x3C '<'
+    {112, 5, 6, 0}, // 0x3D '='
+    {117, 4, 5, 0}, // 0x3E '>'
+    {121, 5, 6, 0}, // 0x3F '?'
+    {126, 5, 6, 0}, // 0x40 '@'
+    {131, 5, 6, 0}, // 0x41 'A'
+    {136, 5, 6, 0}, // 0x42 'B'
+    {141, 5, 6, 0}, // 0x43 'C'
+    {146, 5, 6, 0}, // 0x44 'D'
+    {151, 5, 6, 0}, // 0x45 'E'
+    {156, 5, 6, 0}, // 0x46 'F'
+    {161, 5, 6, 0}, // 0x47 'G'
+    {166, 5, 6, 0}, // 0x48 'H'
+    {171, 3, 4, 0}, // 0x49 'I'
+    {174, 5, 6, 0}, // 0x4A 'J'
+    {179, 5, 6, 0}, // 0x4B 'K'
+    {184, 5, 6, 0}, // 0x4C 'L'
+    {189, 5, 6, 0}, // 0x4D 'M'
+    {194, 5, 6, 0}, // 0x4E 'N'
+    {199, 5, 6, 0}, // 0x4F 'O'
+    {204, 5, 6, 0}, // 0x50 'P'
+    {209, 5, 6, 0}, // 0x51 'Q'
+    {214, 5, 6, 0}, // 0x52 'R'
+    {219, 5, 6, 0}, // 0x53 'S'
+    {224, 5, 6, 0}, // 0x54 'T'
+    {229, 5, 6, 0}, // 0x55 'U'
+    {234, 5, 6, 0}, // 0x56 'V'
+    {239, 5, 6, 0}, // 0x57 'W'
+    {244, 5, 6, 0}, // 0x58 'X'
+    {249, 5, 6, 0}, // 0x59 'Y'
+    {254, 5, 6, 0}, // 0x5A 'Z'
+    {259, 3, 4, 0}, // 0x5B '['
+    {262, 5, 6, 0}, // 0x5C '\\'
+    {267, 3, 4, 0}, // 0x5D ']'
+    {270, 5, 6, 0}, // 0x5E '^'
+    {275, 5, 6, 0}, // 0x5F '_'
+    {280, 3, 4, 0}, // 0x60 '`'
+    {283, 5, 6, 0}, // 0x61 'a'
+    {288, 5, 6, 0}, // 0x62 'b'
+    {293, 5, 6, 0}, // 0x63 'c'
+    {298, 5, 6, 0}, // 0x64 'd'
+    {303, 5, 6, 0}, // 0x65 'e'
+    {308, 5, 6, 0}, // 0x66 'f'
+    {313, 5, 6, 0}, // 0x67 'g'
+    {318, 5, 6, 0}, // 0x68 'h'
+    {323, 3, 4, 0}, // 0x69 'i'
+    {326, 4, 5, 0}, // 0x6A 'j'
+    {330, 4, 5, 0}, // 0x6B 'k'
+    {334, 3, 4, 0}, // 0x6C 'l'
+    {337, 5, 6, 0}, // 0x6D 'm'
+    {342, 5, 6, 0}, // 0x6E 'n'
+    {347, 5, 6, 0}, // 0x6F 'o'
+    {352, 5, 6, 0}, // 0x70 'p'
+    {357, 5, 6, 0}, // 0x71 'q'
+    {362, 5, 6, 0}, // 0x72 'r'
+    {367, 5, 6, 0}, // 0x73 's'
+    {372, 5, 6, 0}, // 0x74 't'
+    {377, 5, 6, 0}, // 0x75 'u'
+    {382, 5, 6, 0}, // 0x76 'v'
+    {387, 5, 6, 0}, // 0x77 'w'
+    {392, 5, 6, 0}, // 0x78 'x'
+    {397, 5, 6, 0}, // 0x79 'y'
+    {402, 5, 6, 0}  // 0x7A 'z'
+};
+
+// font_5x7 digits scaled to 10x16 for big numerals, covers '-' to ':'.
+// every glyph holds its top page row of 10 bytes then its bottom one,
+// use it with ssd1306_init_oled_font( font_10x16_digits, 10, 16, 45 ).
+
+const uint8_t font_10x16_digits[][20] = {
+    {0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x2D '-'
+    {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x3C,0x3C,0x3C,0x00,0x00,0x00,0x00}, // 0x2E '.'
+    {0x00,0x00,0x00,0x00,0xC0,0xC0,0x30,0x30,0x0C,0x0C,0x0C,0x0C,0x03,0x03,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x2F '/'
+    {0xFC,0xFC,0x03,0x03,0xC3,0xC3,0x33,0x33,0xFC,0xFC,0x0F,0x0F,0x33,0x33,0x30,0x30,0x30,0x30,0x0F,0x0F}, // 0x30 '0'
+    {0x00,0x00,0x0C,0x0C,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x30,0x3F,0x3F,0x30,0x30,0x00,0x00}, // 0x31 '1'
+    {0x0C,0x0C,0x03,0x03,0x03,0x03,0xC3,0xC3,0x3C,0x3C,0x30,0x30,0x3C,0x3C,0x33,0x33,0x30,0x30,0x30,0x30}, // 0x32 '2'
+    {0x03,0x03,0x03,0x03,0x33,0x33,0xCF,0xCF,0x03,0x03,0x0C,0x0C,0x30,0x30,0x30,0x30,0x30,0x30,0x0F,0x0F}, // 0x33 '3'
+    {0xC0,0xC0,0x30,0x30,0x0C,0x0C,0xFF,0xFF,0x00,0x00,0x03,0x03,0x03,0x03,0x03,0x03,0x3F,0x3F,0x03,0x03}, // 0x34 '4'
+    {0x3F,0x3F,0x33,0x33,0x33,0x33,0x33,0x33,0xC3,0xC3,0x0C,0x0C,0x30,0x30,0x30,0x30,0x30,0x30,0x0F,0x0F}, // 0x35 '5'
+    {0xF0,0xF0,0xCC,0xCC,0xC3,0xC3,0xC3,0xC3,0x00,0x00,0x0F,0x0F,0x30,0x30,0x30,0x30,0x30,0x30,0x0F,0x0F}, // 0x36 '6'
+    {0x03,0x03,0x03,0x03,0xC3,0xC3,0x33,0x33,0x0F,0x0F,0x00,0x00,0x3F,0x3F,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x37 '7'
+    {0x3C,0x3C,0xC3,0xC3,0xC3,0xC3,0xC3,0xC3,0x3C,0x3C,0x0F,0x0F,0x30,0x30,0x30,0x30,0x30,0x30,0x0F,0x0F}, // 0x38 '8'
+    {0x3C,0x3C,0xC3,0xC3,0xC3,0xC3,0xC3,0xC3,0xFC,0xFC,0x00,0x00,0x30,0x30,0x30,0x30,0x0C,0x0C,0x03,0x03}, // 0x39 '9'
+    {0x00,0x00,0x3C,0x3C,0x3C,0x3C,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0x0F,0x0F,0x0F,0x00,0x00,0x00,0x00}  // 0x3A ':'
+};
+
+// symbols outside ASCII in the style of font_5x7, drawn from UTF-8 strings through its code point index:
+// ssd1306_set_oled_font_ranges( font, font_5x7_symbols_ranges, 3 ) on
+// ssd1306_init_oled_font( font_5x7_symbols, 5, 8, 0 ).
+
+const uint8_t font_5x7_symbols[][5] = {
+    {0x00,0x06,0x09,0x09,0x06}, // U+00B0 '°'
+    {0xF8,0x40,0x40,0x20,0x78}, // U+00B5 'µ'
+    {0x08,0x1C,0x2A,0x08,0x08}, // U+2190 '←'
+    {0x04,0x02,0x7F,0x02,0x04}, // U+2191 '↑'
+    {0x08,0x08,0x2A,0x1C,0x08}, // U+2192 '→'
+    {0x10,0x20,0x7F,0x20,0x10}  // U+2193 '↓'
+};
+
+const font_range font_5x7_symbols_ranges[3] = {
+    {0x00B0, 1, 0},
+    {0x00B5, 1, 1},
+    {0x2190, 4, 2}
+};
+
+#endif
@@ -2,10 +2,13 @@
 #define SSD1306_OLED_H
 
 #include <stdint.h>
-#include <driver/i2c_master.h>
 #include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "esp_err.h"
+#include "ssd1306_transport.h"
 
-// I2C Config parameters.
+// I2C Config parameters ( used by the I2C transport ).
 
 #define I2C_PORT                    0
 #define I2C_MASTER_SCL_IO           22
@@ -13,7 +16,35 @@
 #define I2C_SCL_SPEED               400000
 #define GLITCH_IGNORE_CNT           7
 #define ENABLE_INPERRUPT_PULLUP     1
+#define I2C_TRANS_QUEUE_DEPTH       4           // > 0 enables asynchronous ( DMA / interrupt driven ) data transfers
 #define XFER_TIMEOUT_MS             (1000 / portTICK_PERIOD_MS)
+#define OLED_COMMAND_QUEUE_SIZE     48
+
+// SSD1306 panel geometry.
+
+#define OLED_WIDTH                  128
+#define OLED_PAGES                  8
+
+// Flush cost model: bytes spent on every extra window besides its data
+// ( 7 byte window command + data control byte + address bytes of both transactions ).
+
+#define OLED_WINDOW_OVERHEAD_BYTES  10
+#define OLED_MAX_FLUSH_WINDOWS      16
+
+// Hardware scroll: full width horizontal scrolls run on the controller itself,
+// the interval is the 3 bit frame interval of the scroll setup command ( 0x07 = 2 frames ).
+
+#define OLED_HW_SCROLL              1
+#define OLED_HW_SCROLL_INTERVAL     0x07
+
+// Software scroll: default time between two steps of a scrolling view.
+
+#define OLED_SCROLL_PERIOD_MS       20
+
+// Draw state of a view: nesting of ssd1306_begin_oled_draw in the low bits, ended draws counted above them.
+
+#define OLED_DRAW_DEPTH_MASK        0xFF
+#define OLED_DRAW_ENDED             (OLED_DRAW_DEPTH_MASK + 1)
 
 // SSD1306 oled commands, taken from it datasheet.
 
@@ -63,6 +94,41 @@ typedef enum
 } scroll_type;                             
 
 
+// enum for selecting how a view is flushed to the oled.
+typedef enum
+{
+    FLUSH_FULL,
+    FLUSH_DIRTY,
+    FLUSH_DIFF
+} flush_mode;
+
+
+// enum for how a blitted bitmap is combined with the view.
+typedef enum
+{
+    BLIT_COPY,                              // view = bitmap
+    BLIT_OR,                                // view |= bitmap
+    BLIT_AND,                               // view &= bitmap
+    BLIT_XOR,                               // view ^= bitmap
+    BLIT_AND_NOT                            // view &= ~bitmap, clears the lit pixels of the bitmap
+} blit_op;
+
+
+// dirty region of a view in view columns/pages (inclusive), empty when col_start > col_end.
+// it is one word, so draws merge into it and flushes take it atomically ( widths are <= 128 ).
+typedef union
+{
+    struct
+    {
+        uint8_t col_start;
+        uint8_t col_end;
+        uint8_t page_start;
+        uint8_t page_end;
+    };
+    uint32_t word;
+} oled_dirty_region;
+
+
 // struct for managing the oled buffer with different properties.
 typedef struct
 {
@@ -74,9 +140,53 @@ typedef struct
     uint8_t page_pos;
     scroll_type scroll_type;
     uint8_t cursor;
+    uint16_t col_origin;                    // buffer column shown at the left edge of the view ( horizontal scrolling ),
+    uint16_t row_origin;                    // buffer row shown at the top of the view ( vertical scrolling ), both under the flush lock
+    uint16_t shown_col_origin;              // origins the screen shows, a flush sends the whole view when they moved
+    uint16_t shown_row_origin;
+    uint32_t draw_seq;                      // draw state ( OLED_DRAW_* ), flushes only copy the view when no draw runs and it is unchanged
+    flush_mode flush_mode;
+    oled_dirty_region dirty;                // only through ssd1306_mark_oled_view_dirty / ssd1306_take_oled_view_dirty
+    uint8_t *oled_front_buffer;             // frame on the wire during an async flush ( NULL until the first one )
+    SemaphoreHandle_t flush_done;           // given when no async flush of the view is in flight
+    ssd1306_transfer_done_cb flush_callback;    // runs in interrupt context with an asynchronous transport
+    void *flush_callback_arg;
 } oled_buffer;
 
 
+// struct for batching commands into a single transaction, buffer[0] holds the 0x00 control byte.
+typedef struct
+{
+    uint8_t buffer[OLED_COMMAND_QUEUE_SIZE];
+    uint16_t length;
+} oled_command_queue;
+
+
+// metrics of one glyph of a proportional font.
+typedef struct
+{
+    uint16_t bitmap_offset;                 // first column of the glyph in the font array
+    uint8_t width;                          // columns stored for the glyph
+    uint8_t advance;                        // cursor movement after the glyph
+    int8_t x_offset;                        // columns between the cursor and the first stored column
+} font_glyph;
+
+// kerning pair of a proportional font, the table is sorted by left then right glyph.
+typedef struct
+{
+    uint16_t left;
+    uint16_t right;
+    int8_t adjust;                          // added to the advance of the left glyph
+} font_kerning;
+
+// run of code points mapped to consecutive glyphs, the table is sorted by first code point.
+typedef struct
+{
+    uint32_t first;                         // first code point of the run
+    uint16_t count;                         // code points in the run
+    uint16_t glyph;                         // glyph index of the first code point
+} font_range;
+
 // struct for managing the fonts.
 typedef struct
 {
@@ -84,6 +194,14 @@ typedef struct
     uint8_t width;
     uint8_t height;
     uint8_t offset;
+    const font_glyph *glyphs;               // per glyph metrics, NULL for a fixed width font
+    uint16_t glyph_count;                   // glyphs in font_array, 0 if unknown
+    const font_kerning *kerning;
+    uint16_t kerning_count;
+    const font_range *ranges;               // code point index, NULL to map code point - offset to the glyph
+    uint16_t range_count;
+    uint8_t cached;                         // set by ssd1306_cache_oled_font
+    uint8_t *shift_cache[8];                // per y bit offset: every glyph pre-shifted into its upper and lower page columns
 } font_pack;
 
 
@@ -91,6 +209,10 @@ typedef struct
 struct active_scroll_view;
 typedef struct active_scroll_view {
     oled_buffer *view;
+    TickType_t period;                      // ticks between two steps of this view
+    TickType_t deadline;                    // tick the next step is due at
+    uint16_t step;                          // pixels moved on every step
+    uint8_t due;                            // set by the scroll task while flushing the views it advanced
     struct active_scroll_view *next_view;
     struct active_scroll_view *prev_view;
 } active_scroll_view;
@@ -99,12 +221,24 @@ typedef struct active_scroll_view {
 
 
 
+void ssd1306_init_oled(const ssd1306_transport *transport);
+
+#ifdef ESP_PLATFORM
 void ssd1306_init_oled_i2c( uint8_t i2c_address, uint8_t sda_gpio_pin, uint8_t scl_gpio_pin );
+#endif
 
 font_pack *ssd1306_init_oled_font(const uint8_t *font_array, uint8_t width, uint8_t height, uint8_t offset);
 
 void ssd1306_delete_oled_font(font_pack *font_array);
 
+void ssd1306_set_oled_font_glyphs(font_pack *font_pack, const font_glyph *glyphs, uint16_t glyph_count);
+
+void ssd1306_set_oled_font_kerning(font_pack *font_pack, const font_kerning *kerning, uint16_t kerning_count);
+
+void ssd1306_set_oled_font_ranges(font_pack *font_pack, const font_range *ranges, uint16_t range_count);
+
+void ssd1306_cache_oled_font(font_pack *font_pack, uint16_t glyph_count);
+
 oled_buffer *ssd1306_create_viewbox(uint16_t width, uint8_t page);
 
 void ssd1306_delete_viewbox(oled_buffer *oled_user_buffer);
@@ -115,6 +249,14 @@ void ssd1306_draw_circle(oled_buffer *buf, int xc, int yc, int r);
 
 void ssd1306_send_oled_command(uint8_t command);
 
+void ssd1306_begin_oled_commands(oled_command_queue *queue);
+
+void ssd1306_queue_oled_command(oled_command_queue *queue, uint8_t command);
+
+void ssd1306_queue_oled_command_args(oled_command_queue *queue, uint8_t command, const uint8_t *args, size_t count);
+
+void ssd1306_send_oled_commands(oled_command_queue *queue);
+
 void ssd1306_oled_clear_view(oled_buffer * oled_user_buffer, uint8_t clear_with);
 
 void ssd1306_oled_clear(uint8_t clear_with);
@@ -125,25 +267,79 @@ void ssd1306_send_oled_buffer(uint8_t * buffer, size_t size);
 
 void ssd1306_send_oled_display_buffer(oled_buffer *oled_user_buffer);
 
+esp_err_t ssd1306_send_oled_display_buffer_async(oled_buffer *oled_user_buffer, ssd1306_transfer_done_cb done, void *user_arg);
+
+void ssd1306_wait_oled_flush(oled_buffer *oled_user_buffer);
+
+void ssd1306_set_oled_flush_mode(oled_buffer *oled_user_buffer, flush_mode mode);
+
+void ssd1306_mark_oled_view_dirty(oled_buffer *oled_user_buffer, int32_t col_start, int32_t col_end, int32_t page_start, int32_t page_end);
+
+void ssd1306_mark_oled_view_clean(oled_buffer *oled_user_buffer);
+
+oled_dirty_region ssd1306_get_oled_view_dirty(const oled_buffer *oled_user_buffer);
+
+oled_dirty_region ssd1306_take_oled_view_dirty(oled_buffer *oled_user_buffer);
+
+void ssd1306_begin_oled_draw(oled_buffer *oled_user_buffer);
+
+void ssd1306_end_oled_draw(oled_buffer *oled_user_buffer);
+
+void ssd1306_read_oled_view_span(const oled_buffer *oled_user_buffer, uint8_t page, uint16_t col, uint16_t count, uint8_t *dst);
+
+void ssd1306_rotate_oled_view(oled_buffer *oled_user_buffer, int32_t columns);
+
+void ssd1306_shift_oled_view_rows(oled_buffer *oled_user_buffer, int32_t rows);
+
+void ssd1306_roll_oled_view(oled_buffer *oled_user_buffer, int32_t rows);
+
 void ssd1306_scroll_oled_stop(void);
 
 void ssd1306_scroll_oled_view(oled_buffer *oled_user_buffer, scroll_type scroll);
 
+void ssd1306_scroll_oled_view_rate(oled_buffer *oled_user_buffer, scroll_type scroll, uint32_t period_ms, uint16_t step);
+
 void ssd1306_scroll_stop_oled_view(oled_buffer *oled_user_buffer);
 
 void ssd1306_draw_oled_apixel(oled_buffer *oled_user_buffer, int32_t draw_x, int32_t draw_y, uint8_t fill);
 
 void ssd1306_draw_oled_line(oled_buffer *oled_user_buffer, int32_t start_x, int32_t start_y, int32_t end_x, int32_t end_y, uint8_t fill);
 
+void ssd1306_draw_oled_rect(oled_buffer *oled_user_buffer, int32_t x, int32_t y, int32_t width, int32_t height, uint8_t fill);
+
+void ssd1306_fill_oled_rect(oled_buffer *oled_user_buffer, int32_t x, int32_t y, int32_t width, int32_t height, uint8_t fill);
+
+void ssd1306_draw_oled_round_rect(oled_buffer *oled_user_buffer, int32_t x, int32_t y, int32_t width, int32_t height, int32_t r, uint8_t fill);
+
+void ssd1306_fill_oled_round_rect(oled_buffer *oled_user_buffer, int32_t x, int32_t y, int32_t width, int32_t height, int32_t r, uint8_t fill);
+
+void ssd1306_draw_oled_circle(oled_buffer *oled_user_buffer, int32_t xc, int32_t yc, int32_t r, uint8_t fill);
+
+void ssd1306_fill_oled_circle(oled_buffer *oled_user_buffer, int32_t xc, int32_t yc, int32_t r, uint8_t fill);
+
+void ssd1306_draw_oled_ellipse(oled_buffer *oled_user_buffer, int32_t xc, int32_t yc, int32_t rx, int32_t ry, uint8_t fill);
+
+void ssd1306_fill_oled_ellipse(oled_buffer *oled_user_buffer, int32_t xc, int32_t yc, int32_t rx, int32_t ry, uint8_t fill);
+
 void ssd1306_draw_oled_char(oled_buffer *oled_user_buffer, int cursor,char c, font_pack *font_pack, int offset);
 
 void ssd1306_draw_oled_string(oled_buffer *oled_user_buffer, int cursor, const char *c, font_pack *font_pack, int y_offset);
 
+void ssd1306_draw_oled_text(oled_buffer *oled_user_buffer, int cursor, const char *string, size_t length, font_pack *font_pack, int y_offset, int clip_start, int clip_end);
+
+uint16_t ssd1306_measure_oled_string(const font_pack *font_pack, const char *string, size_t length);
+
 void scroll_task(void *pvargs);
 
 void ssd1306_shift_oled_buffer(oled_buffer *oled_user_buffer,scroll_type direction,uint32_t steps);
 
 void ssd1306_inset_oled_bitmap(oled_buffer *oled_user_buffer, const uint8_t *bitmap, int16_t size);
 
+esp_err_t ssd1306_inset_oled_packed_bitmap(oled_buffer *oled_user_buffer, int32_t col, int32_t page, const uint8_t *packed, size_t size);
+
+void ssd1306_blit_oled_bitmap(oled_buffer *oled_user_buffer, int32_t x, int32_t y, const uint8_t *bitmap, uint16_t width, uint16_t height, blit_op op);
+
+void ssd1306_blit_oled_area(oled_buffer *oled_user_buffer, int32_t x, int32_t y, const uint8_t *bitmap, uint16_t bitmap_width, int32_t src_x, int32_t src_y, int32_t width, int32_t height, blit_op op);
+
 
 #endif 
\ No newline at end of file
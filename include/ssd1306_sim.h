@@ -0,0 +1,79 @@
+#ifndef SSD1306_SIM_H
+#define SSD1306_SIM_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "ssd1306_oled.h"
+#include "ssd1306_transport.h"
+
+#define SSD1306_SIM_ROWS            (OLED_PAGES * 8)
+
+
+// struct for the state of a simulated ssd1306 controller.
+typedef struct
+{
+    uint8_t gddram[OLED_PAGES][OLED_WIDTH];     // graphic display data RAM
+
+    // addressing
+    uint8_t address_mode;                       // 0 horizontal, 1 vertical, 2 page
+    uint8_t col_start;
+    uint8_t col_end;
+    uint8_t page_start;
+    uint8_t page_end;
+    uint8_t col;                                // current RAM pointer
+    uint8_t page;
+    uint8_t page_mode_col_start;                // column start set with 0x00-0x1F in page mode
+
+    // display
+    uint8_t start_line;
+    uint8_t display_offset;
+    uint8_t contrast;
+    uint8_t display_on;
+    uint8_t inverse;
+    uint8_t entire_on;
+
+    // scrolling
+    uint8_t scroll_active;
+    uint8_t scroll_command;                     // last scroll setup command ( 0x26, 0x27, 0x29 or 0x2A )
+    uint8_t scroll_start_page;
+    uint8_t scroll_end_page;
+    uint8_t scroll_interval;                    // frames between two scroll steps
+    uint8_t scroll_vertical_offset;
+    uint8_t scroll_area_top;                    // vertical scroll area set with 0xA3
+    uint8_t scroll_area_rows;
+    uint8_t scroll_vertical_position;           // rows scrolled so far inside the vertical scroll area
+    uint32_t scroll_frame;
+
+    // command parser
+    uint8_t command[8];
+    uint8_t command_length;
+    uint8_t command_expected;
+
+    // traffic counters
+    uint32_t transactions;
+    uint32_t command_transactions;
+    uint32_t data_transactions;
+    uint64_t bytes;
+    uint64_t command_bytes;
+    uint64_t data_bytes;
+    uint32_t unknown_commands;
+} ssd1306_sim;
+
+
+
+void ssd1306_sim_init(ssd1306_sim *sim);
+
+void ssd1306_sim_reset_counters(ssd1306_sim *sim);
+
+void ssd1306_sim_feed(ssd1306_sim *sim, const uint8_t *buffer, size_t size);
+
+void ssd1306_sim_advance_frames(ssd1306_sim *sim, uint32_t frames);
+
+uint8_t ssd1306_sim_get_pixel(const ssd1306_sim *sim, uint8_t x, uint8_t y);
+
+void ssd1306_sim_render(const ssd1306_sim *sim, uint8_t frame[OLED_PAGES][OLED_WIDTH]);
+
+ssd1306_transport *ssd1306_create_sim_transport(ssd1306_sim *sim);
+
+
+#endif
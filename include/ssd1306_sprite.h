@@ -0,0 +1,56 @@
+#ifndef SSD1306_SPRITE_H
+#define SSD1306_SPRITE_H
+
+#include <stdint.h>
+#include "esp_err.h"
+#include "ssd1306_oled.h"
+
+#define OLED_MAX_SPRITES            8
+
+
+// struct for a small bitmap moving over the content of a view.
+typedef struct
+{
+    const uint8_t *bitmap;              // page-major, ( height + 7 ) / 8 page rows of width bytes
+    const uint8_t *mask;                // same layout as the bitmap, lit where the sprite covers the view, NULL for an opaque rectangle
+    uint16_t width;
+    uint16_t height;
+    int16_t x;                          // position asked for, in view pixels
+    int16_t y;
+    uint8_t visible;
+    uint8_t changed;                    // position, visibility or bitmap changed since the last update
+    uint8_t shown;                      // set while the sprite is drawn in the view
+    int16_t shown_x;                    // position the sprite is drawn at
+    int16_t shown_y;
+    oled_buffer *background;            // view pixels under the sprite where it is drawn
+} oled_sprite;
+
+
+// struct for the sprites drawn over one view, back to front.
+typedef struct
+{
+    oled_buffer *view;
+    oled_sprite sprites[OLED_MAX_SPRITES];
+    uint8_t sprite_count;
+} oled_sprite_layer;
+
+
+
+oled_sprite_layer *ssd1306_create_sprite_layer(oled_buffer *view);
+
+void ssd1306_delete_sprite_layer(oled_sprite_layer *layer);
+
+oled_sprite *ssd1306_add_oled_sprite(oled_sprite_layer *layer, const uint8_t *bitmap, const uint8_t *mask, uint16_t width, uint16_t height);
+
+void ssd1306_move_oled_sprite(oled_sprite *sprite, int16_t x, int16_t y);
+
+void ssd1306_show_oled_sprite(oled_sprite *sprite, uint8_t visible);
+
+void ssd1306_set_oled_sprite_bitmap(oled_sprite *sprite, const uint8_t *bitmap, const uint8_t *mask);
+
+void ssd1306_update_oled_sprites(oled_sprite_layer *layer);
+
+void ssd1306_clear_oled_sprites(oled_sprite_layer *layer);
+
+
+#endif
@@ -0,0 +1,58 @@
+#ifndef SSD1306_TEXT_H
+#define SSD1306_TEXT_H
+
+#include <stdint.h>
+#include "esp_err.h"
+#include "ssd1306_oled.h"
+
+#define OLED_TEXT_LINE_SPACING      1           // blank rows between two lines of a layout
+
+
+// enum for the horizontal alignment of the lines of a layout.
+typedef enum
+{
+    TEXT_ALIGN_LEFT,
+    TEXT_ALIGN_CENTER,
+    TEXT_ALIGN_RIGHT
+} text_align;
+
+
+// one line of a layout, a slice of the laid out string.
+typedef struct
+{
+    uint16_t start;                     // first byte of the line in the string
+    uint16_t length;                    // bytes of the line, trailing spaces excluded
+    int16_t x;                          // cursor of the line in the view
+    int16_t y;                          // y offset of the line in the view
+} text_line;
+
+
+// struct for a string laid out in a box of a view, computed once and drawn as often as needed.
+typedef struct
+{
+    const char *string;                 // referenced, keep it alive as long as the layout
+    font_pack *font;
+    int16_t x;                          // box the string is laid out in, in view pixels
+    int16_t y;
+    uint16_t width;
+    uint16_t height;
+    text_align align;
+    uint16_t text_width;                // widest line
+    uint16_t text_height;               // rows used by the lines
+    uint8_t truncated;                  // set when the string didn't fit in the box
+    uint16_t line_count;
+    text_line *lines;
+} text_layout;
+
+
+
+text_layout *ssd1306_create_text_layout(const char *string, font_pack *font_pack, int16_t x, int16_t y, uint16_t width, uint16_t height, text_align align);
+
+void ssd1306_delete_text_layout(text_layout *layout);
+
+esp_err_t ssd1306_update_text_layout(text_layout *layout, const char *string);
+
+void ssd1306_draw_text_layout(oled_buffer *oled_user_buffer, const text_layout *layout);
+
+
+#endif
@@ -0,0 +1,53 @@
+#ifndef SSD1306_TRANSPORT_H
+#define SSD1306_TRANSPORT_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "esp_err.h"
+
+
+// callback called once an asynchronous transfer is finished, it may run in interrupt context.
+// it returns true when it woke a higher priority task ( e.g. through xSemaphoreGiveFromISR ),
+// the bus driver yields on its way out of the interrupt then.
+typedef bool (*ssd1306_transfer_done_cb)(void *user_arg);
+
+
+// struct describing the bus the ssd1306 is connected through.
+// every buffer starts with its control byte, 0x00 for commands and 0x40 for data.
+typedef struct
+{
+    esp_err_t (*transmit_command)(void *ctx, const uint8_t *buffer, size_t size);
+    esp_err_t (*transmit_data)(void *ctx, const uint8_t *buffer, size_t size);
+    esp_err_t (*transmit_data_async)(void *ctx, const uint8_t *buffer, size_t size, ssd1306_transfer_done_cb done, void *user_arg);  // optional, NULL if the bus can't do it
+    void *ctx;
+} ssd1306_transport;
+
+
+// struct for the in-memory bus of the host transport, it counts the traffic and
+// optionally captures it or hands every transaction to a sink.
+typedef struct
+{
+    uint32_t command_transactions;
+    uint32_t data_transactions;
+    uint64_t command_bytes;
+    uint64_t data_bytes;
+    uint8_t *capture;                                                       // optional capture buffer, filled until capture_capacity
+    size_t capture_capacity;
+    size_t capture_size;
+    void (*sink)(void *sink_arg, const uint8_t *buffer, size_t size);      // optional, called for every transaction
+    void *sink_arg;
+} ssd1306_host_bus;
+
+
+
+#ifdef ESP_PLATFORM
+ssd1306_transport *ssd1306_create_i2c_transport(uint8_t i2c_address, uint8_t sda_gpio_pin, uint8_t scl_gpio_pin);
+#endif
+
+ssd1306_transport *ssd1306_create_host_transport(ssd1306_host_bus *bus);
+
+void ssd1306_reset_host_bus(ssd1306_host_bus *bus);
+
+
+#endif
@@ -0,0 +1,13 @@
+#ifndef SSD1306_HOST_ESP_LOG_H
+#define SSD1306_HOST_ESP_LOG_H
+
+// Host (Linux) stand-in for the ESP-IDF esp_log.h, logs go to stderr.
+
+#include <stdio.h>
+
+#define ESP_LOGE(tag, format, ...) fprintf(stderr, "E (%s): " format "\n", tag, ##__VA_ARGS__)
+#define ESP_LOGW(tag, format, ...) fprintf(stderr, "W (%s): " format "\n", tag, ##__VA_ARGS__)
+#define ESP_LOGI(tag, format, ...) fprintf(stderr, "I (%s): " format "\n", tag, ##__VA_ARGS__)
+#define ESP_LOGD(tag, format, ...) ((void)(tag))
+
+#endif
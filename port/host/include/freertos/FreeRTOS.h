@@ -0,0 +1,24 @@
+#ifndef SSD1306_HOST_FREERTOS_H
+#define SSD1306_HOST_FREERTOS_H
+
+// Host (Linux) stand-in for the FreeRTOS types used by the ssd1306 driver,
+// implemented on top of pthreads in port/host/ssd1306_port_host.c.
+
+#include <stdint.h>
+#include <stdlib.h>
+
+typedef uint32_t TickType_t;
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+
+#define configTICK_RATE_HZ      1000
+#define portTICK_PERIOD_MS      ((TickType_t)1000 / configTICK_RATE_HZ)
+#define portMAX_DELAY           ((TickType_t)0xffffffffUL)
+#define pdMS_TO_TICKS(ms)       ((TickType_t)(((uint64_t)(ms) * configTICK_RATE_HZ) / 1000))
+#define pdFALSE                 ((BaseType_t)0)
+#define pdTRUE                  ((BaseType_t)1)
+#define pdPASS                  pdTRUE
+#define pdFAIL                  pdFALSE
+#define portYIELD_FROM_ISR(x)   ((void)(x))      // there are no interrupts on the host
+
+#endif
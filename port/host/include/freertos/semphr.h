@@ -0,0 +1,20 @@
+#ifndef SSD1306_HOST_SEMPHR_H
+#define SSD1306_HOST_SEMPHR_H
+
+#include "freertos/FreeRTOS.h"
+
+typedef struct host_semaphore *SemaphoreHandle_t;
+
+SemaphoreHandle_t xSemaphoreCreateBinary(void);
+
+SemaphoreHandle_t xSemaphoreCreateMutex(void);
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t ticks_to_wait);
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore);
+
+BaseType_t xSemaphoreGiveFromISR(SemaphoreHandle_t semaphore, BaseType_t *higher_priority_task_woken);
+
+void vSemaphoreDelete(SemaphoreHandle_t semaphore);
+
+#endif
@@ -0,0 +1,19 @@
+#ifndef SSD1306_HOST_TASK_H
+#define SSD1306_HOST_TASK_H
+
+#include "freertos/FreeRTOS.h"
+
+typedef struct host_task *TaskHandle_t;
+typedef void (*TaskFunction_t)(void *);
+
+BaseType_t xTaskCreate(TaskFunction_t task_code, const char *name, uint32_t stack_depth, void *parameters, UBaseType_t priority, TaskHandle_t *created_task);
+
+void vTaskDelete(TaskHandle_t task);
+
+void vTaskDelay(TickType_t ticks_to_delay);
+
+void vTaskDelayUntil(TickType_t *previous_wake_time, TickType_t time_increment);
+
+TickType_t xTaskGetTickCount(void);
+
+#endif
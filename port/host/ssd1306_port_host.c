@@ -0,0 +1,205 @@
+#define _POSIX_C_SOURCE 200809L     // clock_gettime and pthread_condattr_setclock with -std=c99
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include <pthread.h>
+#include <errno.h>
+#include <time.h>
+
+// Host (Linux) implementation of the FreeRTOS subset used by the ssd1306 driver.
+// a tick is one millisecond, tasks are detached pthreads and semaphores are a
+// counter guarded by a mutex / condition variable.
+
+struct host_task
+{
+    pthread_t thread;
+    TaskFunction_t task_code;
+    void *parameters;
+};
+
+struct host_semaphore
+{
+    pthread_mutex_t lock;
+    pthread_cond_t changed;
+    unsigned int count;
+    unsigned int max_count;
+};
+
+
+/*!
+    @brief  monotonic time as a timespec after the given number of ticks.
+    @param  ticks
+            ticks from now.
+    @return absolute deadline for pthread_cond_timedwait.
+*/
+static struct timespec host_deadline(TickType_t ticks)
+{
+    struct timespec deadline;
+    clock_gettime(CLOCK_MONOTONIC, &deadline);
+    uint64_t ns = (uint64_t)deadline.tv_nsec + ((uint64_t)ticks * portTICK_PERIOD_MS * 1000000ULL);
+    deadline.tv_sec += ns / 1000000000ULL;
+    deadline.tv_nsec = ns % 1000000000ULL;
+    return deadline;
+}
+
+
+static void *host_task_entry(void *arg)
+{
+    struct host_task *task = (struct host_task *)arg;
+    task->task_code(task->parameters);
+    return NULL;
+}
+
+
+BaseType_t xTaskCreate(TaskFunction_t task_code, const char *name, uint32_t stack_depth, void *parameters, UBaseType_t priority, TaskHandle_t *created_task)
+{
+    (void)name;
+    (void)stack_depth;
+    (void)priority;
+
+    struct host_task *task = (struct host_task *)malloc(sizeof(struct host_task));
+    if (!task)
+        return pdFAIL;
+
+    task->task_code = task_code;
+    task->parameters = parameters;
+    if (pthread_create(&task->thread, NULL, host_task_entry, task) != 0)
+    {
+        free(task);
+        return pdFAIL;
+    }
+    pthread_detach(task->thread);
+
+    if (created_task)
+        *created_task = task;
+    return pdPASS;
+}
+
+
+void vTaskDelete(TaskHandle_t task)
+{
+    // only a task deleting itself is supported, which is all the driver does.
+    if (task == NULL)
+        pthread_exit(NULL);
+}
+
+
+TickType_t xTaskGetTickCount(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (TickType_t)(((uint64_t)now.tv_sec * 1000ULL + (uint64_t)now.tv_nsec / 1000000ULL) / portTICK_PERIOD_MS);
+}
+
+
+void vTaskDelay(TickType_t ticks_to_delay)
+{
+    struct timespec delay = {
+        .tv_sec = ((uint64_t)ticks_to_delay * portTICK_PERIOD_MS) / 1000,
+        .tv_nsec = (((uint64_t)ticks_to_delay * portTICK_PERIOD_MS) % 1000) * 1000000L};
+    while (nanosleep(&delay, &delay) == -1 && errno == EINTR)
+        ;
+}
+
+
+void vTaskDelayUntil(TickType_t *previous_wake_time, TickType_t time_increment)
+{
+    *previous_wake_time += time_increment;
+    TickType_t now = xTaskGetTickCount();
+    TickType_t remaining = *previous_wake_time - now;
+
+    // a wake time in the past shows up as a huge unsigned difference.
+    if (remaining != 0 && remaining <= time_increment)
+        vTaskDelay(remaining);
+}
+
+
+static SemaphoreHandle_t host_semaphore_create(unsigned int count, unsigned int max_count)
+{
+    struct host_semaphore *semaphore = (struct host_semaphore *)malloc(sizeof(struct host_semaphore));
+    if (!semaphore)
+        return NULL;
+
+    pthread_condattr_t attr;
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    pthread_mutex_init(&semaphore->lock, NULL);
+    pthread_cond_init(&semaphore->changed, &attr);
+    pthread_condattr_destroy(&attr);
+    semaphore->count = count;
+    semaphore->max_count = max_count;
+    return semaphore;
+}
+
+
+SemaphoreHandle_t xSemaphoreCreateBinary(void)
+{
+    return host_semaphore_create(0, 1);
+}
+
+
+SemaphoreHandle_t xSemaphoreCreateMutex(void)
+{
+    return host_semaphore_create(1, 1);
+}
+
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t ticks_to_wait)
+{
+    struct timespec deadline = host_deadline(ticks_to_wait);
+    BaseType_t taken = pdTRUE;
+
+    pthread_mutex_lock(&semaphore->lock);
+    while (semaphore->count == 0)
+    {
+        if (ticks_to_wait == 0)
+        {
+            taken = pdFALSE;
+            break;
+        }
+        if (ticks_to_wait == portMAX_DELAY)
+            pthread_cond_wait(&semaphore->changed, &semaphore->lock);
+        else if (pthread_cond_timedwait(&semaphore->changed, &semaphore->lock, &deadline) == ETIMEDOUT)
+        {
+            taken = semaphore->count > 0;
+            break;
+        }
+    }
+    if (taken)
+        semaphore->count--;
+    pthread_mutex_unlock(&semaphore->lock);
+    return taken;
+}
+
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore)
+{
+    BaseType_t given = pdFALSE;
+
+    pthread_mutex_lock(&semaphore->lock);
+    if (semaphore->count < semaphore->max_count)
+    {
+        semaphore->count++;
+        given = pdTRUE;
+        pthread_cond_signal(&semaphore->changed);
+    }
+    pthread_mutex_unlock(&semaphore->lock);
+    return given;
+}
+
+
+BaseType_t xSemaphoreGiveFromISR(SemaphoreHandle_t semaphore, BaseType_t *higher_priority_task_woken)
+{
+    if (higher_priority_task_woken)
+        *higher_priority_task_woken = pdFALSE;
+    return xSemaphoreGive(semaphore);
+}
+
+
+void vSemaphoreDelete(SemaphoreHandle_t semaphore)
+{
+    pthread_mutex_destroy(&semaphore->lock);
+    pthread_cond_destroy(&semaphore->changed);
+    free(semaphore);
+}
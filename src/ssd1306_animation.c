@@ -0,0 +1,183 @@
+#include "ssd1306_animation.h"
+#include "ssd1306_bitmap_codec.h"
+#include "freertos/task.h"
+#include "esp_log.h"
+#include <stdlib.h>
+#include <string.h>
+
+static const char *TAG = "oled_animation";                                  // TAG for all the animation LOGS
+
+
+/*!
+    @brief  read a little endian 16 bit value.
+    @param  data
+            first byte.
+    @return value.
+*/
+static uint16_t ssd1306_read_oled_u16(const uint8_t *data)
+{
+    return data[0] | (data[1] << 8);
+}
+
+
+/*!
+    @brief  create a player for an animation.
+    @param  oled_user_buffer
+            oled_buffer the animation is played in.
+    @param  data
+            animation packed with ssd1306_pack_oled_animation, only referenced.
+    @param  size
+            bytes of the animation.
+    @param  col
+            column of the view the frames are drawn at ( 0 based ).
+    @param  page
+            page of the view the frames are drawn at ( 0 based ).
+    @param  fps
+            target frame rate of ssd1306_play_oled_animation.
+    @return animation pointer, NULL if the data is malformed or the allocation failed.
+    @note   the deltas are checked once here. the area is cleared by the first step, the frames are clipped to the view.
+            a FLUSH_FULL view is switched to FLUSH_DIRTY, so every flush only sends the box a frame changed.
+*/
+oled_animation *ssd1306_create_oled_animation(oled_buffer *oled_user_buffer, const uint8_t *data, size_t size, int32_t col, int32_t page, uint32_t fps)
+{
+    if (size < OLED_ANIMATION_HEADER || !fps) {
+        ESP_LOGE(TAG, "Malformed animation.");
+        return NULL;
+    }
+
+    uint16_t frame_count = ssd1306_read_oled_u16(&data[3]);
+    size_t offset = OLED_ANIMATION_HEADER;
+    size_t loop_offset = 0;
+    for (uint32_t d = 0; d <= frame_count; d++)
+    {
+        if (offset + 2 > size || offset + 2 + ssd1306_read_oled_u16(&data[offset]) > size) {
+            ESP_LOGE(TAG, "Malformed animation.");
+            return NULL;
+        }
+        offset += 2 + ssd1306_read_oled_u16(&data[offset]);
+        if (d == 0)
+            loop_offset = offset;
+    }
+    if (!frame_count || !ssd1306_read_oled_u16(&data[0])) {
+        ESP_LOGE(TAG, "Malformed animation.");
+        return NULL;
+    }
+
+    oled_animation *animation = (oled_animation *)malloc(sizeof(oled_animation));
+    if (!animation) {
+        ESP_LOGE(TAG, "Memory allocation failed for animation.");
+        return NULL;
+    }
+
+    animation->view = oled_user_buffer;
+    animation->data = data;
+    animation->size = size;
+    animation->width = ssd1306_read_oled_u16(&data[0]);
+    animation->pages = data[2];
+    animation->frame_count = frame_count;
+    animation->col = col;
+    animation->page = page;
+    animation->period = pdMS_TO_TICKS(1000 / fps) ? pdMS_TO_TICKS(1000 / fps) : 1;
+    animation->loop_offset = loop_offset;
+    ssd1306_rewind_oled_animation(animation);
+
+    if (oled_user_buffer->flush_mode == FLUSH_FULL)
+        ssd1306_set_oled_flush_mode(oled_user_buffer, FLUSH_DIRTY);
+    return animation;
+}
+
+
+/*!
+    @brief  delete the animation player.
+    @param  animation
+            animation pointer.
+    @return None (Void)
+    @note   the frame on the view stays.
+*/
+void ssd1306_delete_oled_animation(oled_animation *animation)
+{
+    free(animation);
+}
+
+
+/*!
+    @brief  start the animation again from frame 0.
+    @param  animation
+            animation pointer.
+    @return None (Void)
+    @note   the next step clears the area of the frames and draws frame 0.
+*/
+void ssd1306_rewind_oled_animation(oled_animation *animation)
+{
+    animation->next_delta = 0;
+    animation->next_offset = OLED_ANIMATION_HEADER;
+}
+
+
+/*!
+    @brief  show the next frame of the animation in the view.
+    @param  animation
+            animation pointer.
+    @return ESP_OK or ESP_ERR_INVALID_ARG if a delta is malformed.
+    @note   after the last frame it continues with frame 0. only the bytes the frame changes are written,
+            and only their box is marked dirty, so a FLUSH_DIRTY or FLUSH_DIFF view sends just that.
+*/
+esp_err_t ssd1306_step_oled_animation(oled_animation *animation)
+{
+    oled_buffer *view = animation->view;
+
+    ssd1306_begin_oled_draw(view);
+    if (animation->next_delta == 0)
+        ssd1306_fill_oled_rect(view, animation->col, animation->page * 8, animation->width, animation->pages * 8, 0);
+
+    const uint8_t *delta = &animation->data[animation->next_offset];
+    uint16_t size = ssd1306_read_oled_u16(delta);
+    oled_delta_area changed = {0, -1, 0, -1};
+    int result = ssd1306_apply_oled_delta(delta + 2, size, animation->width, animation->pages, &view->oled_user_buffer[1],
+                                          view->width, view->page, animation->col, animation->page, &changed);
+    if (changed.col_start <= changed.col_end)
+        ssd1306_mark_oled_view_dirty(view, changed.col_start, changed.col_end, changed.page_start, changed.page_end);
+    ssd1306_end_oled_draw(view);
+
+    // the looping delta brought back frame 0, the next one is delta 1 again.
+    animation->next_offset += 2 + size;
+    if (++animation->next_delta > animation->frame_count)
+    {
+        animation->next_delta = 1;
+        animation->next_offset = animation->loop_offset;
+    }
+
+    if (result != 0)
+    {
+        ESP_LOGE(TAG, "Malformed animation delta.");
+        return ESP_ERR_INVALID_ARG;
+    }
+    return ESP_OK;
+}
+
+
+/*!
+    @brief  play the animation in the calling task.
+    @param  animation
+            animation pointer.
+    @param  loops
+            times the animation is played, 0 to play it forever.
+    @return ESP_OK once played or ESP_ERR_INVALID_ARG if a delta is malformed.
+    @note   every frame is flushed right after its delta and the task waits for the next frame time, frames
+            which took too long are not skipped. it plays on from the frame shown, rewind it to start over.
+*/
+esp_err_t ssd1306_play_oled_animation(oled_animation *animation, uint32_t loops)
+{
+    TickType_t wake = xTaskGetTickCount();
+    uint32_t frames = loops * animation->frame_count;
+
+    for (uint32_t shown = 0; !loops || shown < frames; shown++)
+    {
+        esp_err_t err = ssd1306_step_oled_animation(animation);
+        if (err != ESP_OK)
+            return err;
+        ssd1306_send_oled_display_buffer(animation->view);
+        vTaskDelayUntil(&wake, animation->period);
+    }
+    return ESP_OK;
+}
@@ -0,0 +1,501 @@
+#include "ssd1306_bitmap_codec.h"
+#include <string.h>
+#include <stdint.h>
+
+// the codec only needs the C library, so the asset tools on the host build it as it is.
+
+
+// state of a decode, the bitmap position the next byte goes to.
+typedef struct
+{
+    uint8_t window[OLED_PACKED_WINDOW];     // last bytes produced, for the back references
+    uint32_t produced;
+    uint16_t width;                         // size of the packed bitmap
+    uint8_t pages;
+    uint16_t x;                             // position in the packed bitmap
+    uint8_t y;
+    uint8_t *row;                           // destination page row of y, NULL when it is clipped
+    uint8_t *dst;
+    uint16_t dst_width;
+    uint8_t dst_pages;
+    int32_t col;                            // position of the bitmap in the destination
+    int32_t page;
+} oled_unpack_state;
+
+
+/*!
+    @brief  point the decode at the destination page row of the current bitmap page row.
+    @param  state
+            decode state.
+    @return None (Void)
+*/
+static void ssd1306_unpack_oled_row(oled_unpack_state *state)
+{
+    int32_t page = state->page + state->y;
+    state->row = (page >= 0 && page < state->dst_pages) ? &state->dst[page * state->dst_width] : NULL;
+}
+
+
+/*!
+    @brief  emit one decoded byte.
+    @param  state
+            decode state.
+    @param  byte
+            decoded byte.
+    @return None (Void)
+*/
+static inline void ssd1306_unpack_oled_byte(oled_unpack_state *state, uint8_t byte)
+{
+    state->window[state->produced % OLED_PACKED_WINDOW] = byte;
+    state->produced++;
+
+    int32_t col = state->col + state->x;
+    if (state->row && col >= 0 && col < state->dst_width)
+        state->row[col] = byte;
+
+    if (++state->x == state->width)
+    {
+        state->x = 0;
+        state->y++;
+        ssd1306_unpack_oled_row(state);
+    }
+}
+
+
+/*!
+    @brief  read the size of a packed bitmap.
+    @param  packed
+            packed bitmap.
+    @param  size
+            bytes of the packed bitmap.
+    @param  width
+            filled with the width of the bitmap.
+    @param  pages
+            filled with the pages of the bitmap.
+    @return 0, or -1 if the data is too short to be a packed bitmap.
+*/
+int ssd1306_read_packed_oled_header(const uint8_t *packed, size_t size, uint16_t *width, uint8_t *pages)
+{
+    if (size < OLED_PACKED_HEADER)
+        return -1;
+
+    *width = packed[0] | (packed[1] << 8);
+    *pages = packed[2];
+    return 0;
+}
+
+
+/*!
+    @brief  decode a packed bitmap into a page-major destination.
+    @param  packed
+            packed bitmap.
+    @param  size
+            bytes of the packed bitmap.
+    @param  dst
+            page-major destination, dst_width bytes per page row.
+    @param  dst_width
+            width of the destination.
+    @param  dst_pages
+            pages of the destination.
+    @param  col
+            column of the destination the bitmap lands on, may be outside it.
+    @param  page
+            page of the destination the bitmap lands on, may be outside it.
+    @return 0, or -1 if the data is malformed ( what was decoded until then stays in the destination ).
+    @note   the bitmap is clipped to the destination, decoded bytes go straight to it and only the
+            back reference window is kept aside.
+*/
+int ssd1306_unpack_oled_bitmap(const uint8_t *packed, size_t size, uint8_t *dst, uint16_t dst_width, uint8_t dst_pages, int32_t col, int32_t page)
+{
+    oled_unpack_state state;
+
+    if (ssd1306_read_packed_oled_header(packed, size, &state.width, &state.pages) != 0 || state.width == 0)
+        return -1;
+
+    state.produced = 0;
+    state.x = 0;
+    state.y = 0;
+    state.dst = dst;
+    state.dst_width = dst_width;
+    state.dst_pages = dst_pages;
+    state.col = col;
+    state.page = page;
+    ssd1306_unpack_oled_row(&state);
+
+    uint32_t total = (uint32_t)state.width * state.pages;
+    size_t in = OLED_PACKED_HEADER;
+
+    while (state.produced < total)
+    {
+        if (in >= size)
+            return -1;
+
+        uint8_t token = packed[in++];
+        uint32_t count = token & 0x3F;
+
+        switch (token & 0xC0)
+        {
+        case OLED_PACKED_ZERO:
+            count += 1;
+            if (state.produced + count > total)
+                return -1;
+            while (count--)
+                ssd1306_unpack_oled_byte(&state, 0x00);
+            break;
+
+        case OLED_PACKED_FILL:
+            count += 2;
+            if (in >= size || state.produced + count > total)
+                return -1;
+            while (count--)
+                ssd1306_unpack_oled_byte(&state, packed[in]);
+            in++;
+            break;
+
+        case OLED_PACKED_LITERAL:
+            count += 1;
+            if (in + count > size || state.produced + count > total)
+                return -1;
+            while (count--)
+                ssd1306_unpack_oled_byte(&state, packed[in++]);
+            break;
+
+        default:
+        {
+            count += 3;
+            if (in >= size)
+                return -1;
+            uint32_t distance = packed[in++] + 1;
+            if (distance > state.produced || state.produced + count > total)
+                return -1;
+            while (count--)
+                ssd1306_unpack_oled_byte(&state, state.window[(state.produced - distance) % OLED_PACKED_WINDOW]);
+            break;
+        }
+        }
+    }
+    return 0;
+}
+
+
+/*!
+    @brief  write the pending literal bytes as literal tokens.
+    @param  bitmap
+            bitmap being packed.
+    @param  start
+            first pending byte.
+    @param  end
+            end of the pending bytes.
+    @param  packed
+            output.
+    @param  out
+            position in the output, moved past the tokens.
+    @param  size
+            size of the output.
+    @return 0, or -1 if the output is full.
+*/
+static int ssd1306_pack_oled_literals(const uint8_t *bitmap, uint32_t start, uint32_t end, uint8_t *packed, size_t *out, size_t size)
+{
+    while (start < end)
+    {
+        uint32_t count = end - start > 64 ? 64 : end - start;
+        if (*out + 1 + count > size)
+            return -1;
+        packed[(*out)++] = OLED_PACKED_LITERAL | (count - 1);
+        memcpy(&packed[*out], &bitmap[start], count);
+        *out += count;
+        start += count;
+    }
+    return 0;
+}
+
+
+/*!
+    @brief  pack a page-major bitmap.
+    @param  bitmap
+            page-major bitmap ( vertical 1 byte mode ), pages page rows of width bytes.
+    @param  width
+            width of the bitmap.
+    @param  pages
+            pages of the bitmap.
+    @param  packed
+            output.
+    @param  size
+            size of the output.
+    @return bytes written, 0 if the output is too small.
+    @note   greedy: at every byte the token saving the most output wins ( a zero run, a fill run or the
+            longest back reference in the window ), bytes no token saves anything on are gathered in literals.
+            it searches the whole window for every byte, it is meant for the host asset tools.
+*/
+size_t ssd1306_pack_oled_bitmap(const uint8_t *bitmap, uint16_t width, uint8_t pages, uint8_t *packed, size_t size)
+{
+    uint32_t total = (uint32_t)width * pages;
+    uint32_t literal = 0;
+    uint32_t i = 0;
+    size_t out = 0;
+
+    if (size < OLED_PACKED_HEADER)
+        return 0;
+    packed[out++] = width & 0xFF;
+    packed[out++] = width >> 8;
+    packed[out++] = pages;
+
+    while (i < total)
+    {
+        uint32_t left = total - i;
+
+        uint32_t zero = 0;
+        while (zero < 64 && zero < left && bitmap[i + zero] == 0x00)
+            zero++;
+
+        uint32_t fill = 1;
+        while (fill < 65 && fill < left && bitmap[i + fill] == bitmap[i])
+            fill++;
+
+        uint32_t copy = 0;
+        uint32_t distance = 0;
+        for (uint32_t d = 1; d <= OLED_PACKED_WINDOW && d <= i; d++)
+        {
+            uint32_t m = 0;
+            while (m < 66 && m < left && bitmap[i + m] == bitmap[i + m - d])
+                m++;
+            if (m > copy)
+            {
+                copy = m;
+                distance = d;
+            }
+        }
+
+        // output saved by every token against writing the bytes as literals.
+        int32_t zero_gain = (int32_t)zero - 1;
+        int32_t fill_gain = fill >= 2 ? (int32_t)fill - 2 : -1;
+        int32_t copy_gain = copy >= 3 ? (int32_t)copy - 2 : -1;
+
+        int32_t best = zero_gain > fill_gain ? zero_gain : fill_gain;
+        if (copy_gain > best)
+            best = copy_gain;
+
+        if (best < 1 && !(zero && best == zero_gain))
+        {
+            i++;                            // no token pays off, the byte goes in a literal.
+            continue;
+        }
+
+        if (ssd1306_pack_oled_literals(bitmap, literal, i, packed, &out, size) != 0)
+            return 0;
+
+        if (out + 2 > size)
+            return 0;
+        if (best == zero_gain && zero)
+        {
+            packed[out++] = OLED_PACKED_ZERO | (zero - 1);
+            i += zero;
+        }
+        else if (best == copy_gain)
+        {
+            packed[out++] = OLED_PACKED_COPY | (copy - 3);
+            packed[out++] = distance - 1;
+            i += copy;
+        }
+        else
+        {
+            packed[out++] = OLED_PACKED_FILL | (fill - 2);
+            packed[out++] = bitmap[i];
+            i += fill;
+        }
+        literal = i;
+    }
+
+    if (ssd1306_pack_oled_literals(bitmap, literal, i, packed, &out, size) != 0)
+        return 0;
+    return out;
+}
+
+
+/*!
+    @brief  encode the change between two frames.
+    @param  previous
+            frame shown before, NULL for a blank one.
+    @param  frame
+            frame to show.
+    @param  length
+            bytes of a frame ( width * pages ).
+    @param  delta
+            output.
+    @param  size
+            size of the output.
+    @return bytes written ( 0 for two equal frames ), or SIZE_MAX if the output is too small.
+    @note   changed bytes separated by one or two unchanged ones stay in the same XOR token,
+            that is shorter than closing it for a skip and opening a new one.
+*/
+size_t ssd1306_pack_oled_delta(const uint8_t *previous, const uint8_t *frame, uint32_t length, uint8_t *delta, size_t size)
+{
+    size_t out = 0;
+    uint32_t i = 0;
+
+    // the trailing unchanged bytes need no token.
+    uint32_t end = length;
+    while (end > 0 && frame[end - 1] == (previous ? previous[end - 1] : 0x00))
+        end--;
+
+    while (i < end)
+    {
+        uint32_t same = 0;
+        while (i + same < end && frame[i + same] == (previous ? previous[i + same] : 0x00))
+            same++;
+        while (same > 0)
+        {
+            uint32_t count = same > 128 ? 128 : same;
+            if (out + 1 > size)
+                return SIZE_MAX;
+            delta[out++] = OLED_DELTA_SKIP | (count - 1);
+            same -= count;
+            i += count;
+        }
+
+        // the XOR run ends at the first gap of three unchanged bytes.
+        uint32_t run = 0;
+        uint32_t gap = 0;
+        while (i + run + gap < end && run + gap < 128 && gap < 3)
+        {
+            uint8_t x = frame[i + run + gap] ^ (previous ? previous[i + run + gap] : 0x00);
+            if (x)
+            {
+                run += gap + 1;
+                gap = 0;
+            }
+            else
+                gap++;
+        }
+        if (!run)
+            continue;
+
+        if (out + 1 + run > size)
+            return SIZE_MAX;
+        delta[out++] = OLED_DELTA_XOR | (run - 1);
+        for (uint32_t k = 0; k < run; k++)
+            delta[out++] = frame[i + k] ^ (previous ? previous[i + k] : 0x00);
+        i += run;
+    }
+    return out;
+}
+
+
+/*!
+    @brief  apply a frame delta to a page-major destination.
+    @param  delta
+            frame delta.
+    @param  size
+            bytes of the delta.
+    @param  width
+            width of the frames.
+    @param  pages
+            pages of the frames.
+    @param  dst
+            page-major destination holding the previous frame, dst_width bytes per page row.
+    @param  dst_width
+            width of the destination.
+    @param  dst_pages
+            pages of the destination.
+    @param  col
+            column of the destination the frames are at, may be outside it.
+    @param  page
+            page of the destination the frames are at, may be outside it.
+    @param  changed
+            filled with the box of the destination bytes the delta changed, may be NULL.
+    @return 0, or -1 if the delta is malformed.
+    @note   skipped bytes are never touched, so the cost follows the size of the change, not of the frame.
+*/
+int ssd1306_apply_oled_delta(const uint8_t *delta, size_t size, uint16_t width, uint8_t pages, uint8_t *dst, uint16_t dst_width, uint8_t dst_pages, int32_t col, int32_t page, oled_delta_area *changed)
+{
+    uint32_t total = (uint32_t)width * pages;
+    uint32_t pos = 0;
+    size_t in = 0;
+    oled_delta_area area = {INT32_MAX, INT32_MIN, INT32_MAX, INT32_MIN};
+
+    if (!width)
+        return -1;
+
+    while (in < size)
+    {
+        uint8_t token = delta[in++];
+        uint32_t count = (token & 0x7F) + 1;
+        if (pos + count > total)
+            return -1;
+
+        if (!(token & OLED_DELTA_XOR))
+        {
+            pos += count;
+            continue;
+        }
+
+        if (in + count > size)
+            return -1;
+        for (uint32_t k = 0; k < count; k++, pos++)
+        {
+            uint8_t x = delta[in++];
+            int32_t dst_col = col + (int32_t)(pos % width);
+            int32_t dst_page = page + (int32_t)(pos / width);
+            if (!x || dst_col < 0 || dst_col >= dst_width || dst_page < 0 || dst_page >= dst_pages)
+                continue;
+
+            dst[(dst_page * dst_width) + dst_col] ^= x;
+            if (dst_col < area.col_start) area.col_start = dst_col;
+            if (dst_col > area.col_end) area.col_end = dst_col;
+            if (dst_page < area.page_start) area.page_start = dst_page;
+            if (dst_page > area.page_end) area.page_end = dst_page;
+        }
+    }
+
+    if (changed)
+        *changed = area;
+    return 0;
+}
+
+
+/*!
+    @brief  pack frames into an animation.
+    @param  frames
+            frame_count page-major frames of width * pages bytes, one after the other.
+    @param  frame_count
+            number of frames.
+    @param  width
+            width of the frames.
+    @param  pages
+            pages of the frames.
+    @param  packed
+            output.
+    @param  size
+            size of the output.
+    @return bytes written, 0 if the output is too small.
+*/
+size_t ssd1306_pack_oled_animation(const uint8_t *frames, uint16_t frame_count, uint16_t width, uint8_t pages, uint8_t *packed, size_t size)
+{
+    uint32_t length = (uint32_t)width * pages;
+    size_t out = OLED_ANIMATION_HEADER;
+
+    if (size < OLED_ANIMATION_HEADER || !frame_count)
+        return 0;
+    packed[0] = width & 0xFF;
+    packed[1] = width >> 8;
+    packed[2] = pages;
+    packed[3] = frame_count & 0xFF;
+    packed[4] = frame_count >> 8;
+
+    for (uint32_t f = 0; f <= frame_count; f++)
+    {
+        // frame 0 comes from a blank area, the closing delta goes from the last frame back to frame 0.
+        const uint8_t *previous = f == 0 ? NULL : &frames[(f - 1) * length];
+        const uint8_t *frame = &frames[(f % frame_count) * length];
+
+        if (out + 2 > size)
+            return 0;
+        size_t delta = ssd1306_pack_oled_delta(previous, frame, length, &packed[out + 2], size - out - 2);
+        if (delta == SIZE_MAX || delta > 0xFFFF)
+            return 0;
+        packed[out] = delta & 0xFF;
+        packed[out + 1] = delta >> 8;
+        out += 2 + delta;
+    }
+    return out;
+}
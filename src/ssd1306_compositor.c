@@ -0,0 +1,281 @@
+#include "ssd1306_compositor.h"
+#include "esp_log.h"
+#include <stdlib.h>
+#include <string.h>
+
+static const char *TAG = "oled_compositor";                                 // TAG for all the compositor LOGS
+
+
+/*!
+    @brief  create a compositor with an empty full screen frame.
+    @return compositor pointer, NULL if the allocation failed.
+    @note   the frame is flushed with FLUSH_DIFF, so call ssd1306_oled_clear once before the first
+            flush to let the driver know the screen content.
+*/
+oled_compositor *ssd1306_create_compositor(void)
+{
+    oled_compositor *compositor = (oled_compositor *)malloc(sizeof(oled_compositor));
+    if (!compositor) {
+        ESP_LOGE(TAG, "Memory allocation failed for compositor.");
+        return NULL;
+    }
+
+    compositor->frame = ssd1306_create_viewbox(OLED_WIDTH, OLED_PAGES);
+    if (!compositor->frame) {
+        free(compositor);
+        return NULL;
+    }
+
+    ssd1306_set_oled_flush_mode(compositor->frame, FLUSH_DIFF);
+    compositor->layer_count = 0;
+    return compositor;
+}
+
+
+/*!
+    @brief  delete the compositor and its frame.
+    @param  compositor
+            compositor pointer.
+    @return None (Void)
+    @note   the views placed in the compositor are not deleted.
+*/
+void ssd1306_delete_compositor(oled_compositor *compositor)
+{
+    ssd1306_delete_viewbox(compositor->frame);
+    free(compositor);
+}
+
+
+/*!
+    @brief  mark the screen area covered by a view at the given position as dirty in the frame.
+    @param  compositor
+            compositor pointer.
+    @param  view
+            oled_buffer pointer.
+    @param  col_pos
+            column position of the view ( 1 based, as in ssd1306_place_oled_view ).
+    @param  page_pos
+            page position of the view ( 1 based ).
+    @return None (Void)
+*/
+static void ssd1306_compositor_mark_area(oled_compositor *compositor, oled_buffer *view, int32_t col_pos, int32_t page_pos)
+{
+    ssd1306_mark_oled_view_dirty(compositor->frame, col_pos - 1, col_pos + view->width - 2, page_pos - 1, page_pos + view->page - 2);
+}
+
+
+/*!
+    @brief  find the layer of a view.
+    @param  compositor
+            compositor pointer.
+    @param  view
+            oled_buffer pointer.
+    @return index of the layer, -1 if the view is not in the compositor.
+*/
+static int ssd1306_compositor_find(oled_compositor *compositor, oled_buffer *view)
+{
+    for (int i = 0; i < compositor->layer_count; i++)
+        if (compositor->layers[i].view == view)
+            return i;
+    return -1;
+}
+
+
+/*!
+    @brief  add a view to the compositor.
+    @param  compositor
+            compositor pointer.
+    @param  view
+            oled_buffer pointer, placed with ssd1306_place_oled_view.
+    @param  z
+            stacking order, views with a higher z are drawn on top.
+    @param  blend
+            BLEND_OPAQUE to cover the views below, BLEND_TRANSPARENT to draw only its lit pixels.
+    @return ESP_OK, ESP_ERR_INVALID_STATE if the view is already added or ESP_ERR_NO_MEM if all the layers are used.
+    @note   views with the same z are drawn in the order they were added.
+*/
+esp_err_t ssd1306_compositor_add_view(oled_compositor *compositor, oled_buffer *view, int8_t z, blend_mode blend)
+{
+    if (ssd1306_compositor_find(compositor, view) >= 0)
+        return ESP_ERR_INVALID_STATE;
+
+    if (compositor->layer_count == OLED_MAX_LAYERS) {
+        ESP_LOGE(TAG, "No free layer left in the compositor.");
+        return ESP_ERR_NO_MEM;
+    }
+
+    // keeping the layers sorted back to front.
+    int index = compositor->layer_count;
+    while (index > 0 && compositor->layers[index - 1].z > z)
+    {
+        compositor->layers[index] = compositor->layers[index - 1];
+        index--;
+    }
+
+    oled_layer *layer = &compositor->layers[index];
+    layer->view = view;
+    layer->z = z;
+    layer->blend = blend;
+    layer->placed = 0;
+    compositor->layer_count++;
+    return ESP_OK;
+}
+
+
+/*!
+    @brief  remove a view from the compositor.
+    @param  compositor
+            compositor pointer.
+    @param  view
+            oled_buffer pointer.
+    @return None (Void)
+    @note   the area the view covered is recomposited on the next flush.
+*/
+void ssd1306_compositor_remove_view(oled_compositor *compositor, oled_buffer *view)
+{
+    int index = ssd1306_compositor_find(compositor, view);
+    if (index < 0)
+        return;
+
+    oled_layer *layer = &compositor->layers[index];
+    if (layer->placed)
+        ssd1306_compositor_mark_area(compositor, view, layer->col_pos, layer->page_pos);
+
+    memmove(layer, layer + 1, (compositor->layer_count - index - 1) * sizeof(oled_layer));
+    compositor->layer_count--;
+}
+
+
+/*!
+    @brief  change the stacking order of a view.
+    @param  compositor
+            compositor pointer.
+    @param  view
+            oled_buffer pointer.
+    @param  z
+            new stacking order.
+    @return None (Void)
+*/
+void ssd1306_compositor_set_z(oled_compositor *compositor, oled_buffer *view, int8_t z)
+{
+    int index = ssd1306_compositor_find(compositor, view);
+    if (index < 0)
+        return;
+
+    blend_mode blend = compositor->layers[index].blend;
+    ssd1306_compositor_remove_view(compositor, view);
+    ssd1306_compositor_add_view(compositor, view, z, blend);
+}
+
+
+/*!
+    @brief  draw the part of a layer that falls inside the dirty region of the frame.
+    @param  compositor
+            compositor pointer.
+    @param  layer
+            layer to draw.
+    @return None (Void)
+*/
+static void ssd1306_compositor_draw_layer(oled_compositor *compositor, oled_layer *layer)
+{
+    oled_buffer *frame = compositor->frame;
+    oled_buffer *view = layer->view;
+    int32_t col_origin = (int32_t)view->col_pos - 1;
+    int32_t page_origin = (int32_t)view->page_pos - 1;
+    oled_dirty_region dirty = ssd1306_get_oled_view_dirty(frame);
+
+    // intersecting the view with the dirty region of the frame.
+    int32_t col_start = col_origin > dirty.col_start ? col_origin : dirty.col_start;
+    int32_t col_end = col_origin + view->width - 1 < dirty.col_end ? col_origin + view->width - 1 : dirty.col_end;
+    int32_t page_start = page_origin > dirty.page_start ? page_origin : dirty.page_start;
+    int32_t page_end = page_origin + view->page - 1 < dirty.page_end ? page_origin + view->page - 1 : dirty.page_end;
+    if (col_start > col_end || page_start > page_end)
+        return;
+
+    uint32_t span = col_end - col_start + 1;
+    for (int32_t page = page_start; page <= page_end; page++)
+    {
+        uint8_t *dst = &frame->oled_user_buffer[(page * OLED_WIDTH) + col_start + 1];
+
+        if (layer->blend == BLEND_OPAQUE)
+        {
+            ssd1306_read_oled_view_span(view, page - page_origin, col_start - col_origin, span, dst);
+            continue;
+        }
+
+        uint8_t src[OLED_WIDTH];
+        ssd1306_read_oled_view_span(view, page - page_origin, col_start - col_origin, span, src);
+        for (uint32_t i = 0; i < span; i++)
+            dst[i] |= src[i];
+    }
+}
+
+
+/*!
+    @brief  composite the views into the frame.
+    @param  compositor
+            compositor pointer.
+    @return None (Void)
+    @note   only the screen area touched since the last composition ( drawn regions of the views, moved,
+            added and removed views ) is rebuilt, back to front. uncovered pixels are black.
+*/
+void ssd1306_compose_oled_frame(oled_compositor *compositor)
+{
+    oled_buffer *frame = compositor->frame;
+
+    // collecting the changed screen area.
+    for (int i = 0; i < compositor->layer_count; i++)
+    {
+        oled_layer *layer = &compositor->layers[i];
+        oled_buffer *view = layer->view;
+        oled_dirty_region dirty = ssd1306_take_oled_view_dirty(view);      // the view is clean from here on.
+
+        if (!layer->placed || layer->col_pos != view->col_pos || layer->page_pos != view->page_pos)
+        {
+            if (layer->placed)
+                ssd1306_compositor_mark_area(compositor, view, layer->col_pos, layer->page_pos);
+            ssd1306_compositor_mark_area(compositor, view, view->col_pos, view->page_pos);
+            layer->placed = 1;
+            layer->col_pos = view->col_pos;
+            layer->page_pos = view->page_pos;
+        }
+        else if (dirty.col_start <= dirty.col_end && (view->col_origin != 0 || view->row_origin != 0))
+        {
+            // dirty bytes of a scrolled view are rotated on screen.
+            ssd1306_mark_oled_view_dirty(frame, view->col_pos - 1, view->col_pos + view->width - 2,
+                                         view->page_pos - 1, view->page_pos + view->page - 2);
+        }
+        else if (dirty.col_start <= dirty.col_end)
+        {
+            ssd1306_mark_oled_view_dirty(frame,
+                                         view->col_pos - 1 + dirty.col_start, view->col_pos - 1 + dirty.col_end,
+                                         view->page_pos - 1 + dirty.page_start, view->page_pos - 1 + dirty.page_end);
+        }
+    }
+
+    oled_dirty_region dirty = ssd1306_get_oled_view_dirty(frame);
+    if (dirty.col_start > dirty.col_end)
+        return; // nothing changed.
+
+    uint32_t span = dirty.col_end - dirty.col_start + 1;
+    for (int page = dirty.page_start; page <= dirty.page_end; page++)
+        memset(&frame->oled_user_buffer[(page * OLED_WIDTH) + dirty.col_start + 1], 0x00, span);
+
+    for (int i = 0; i < compositor->layer_count; i++)
+        ssd1306_compositor_draw_layer(compositor, &compositor->layers[i]);
+}
+
+
+/*!
+    @brief  composite the views and send the frame to the ssd1306 oled.
+    @param  compositor
+            compositor pointer.
+    @return None (Void)
+    @note   the frame is compared with the screen content, so all the views together cost at most one
+            set of windows per flush instead of one transfer per view.
+*/
+void ssd1306_send_oled_compositor(oled_compositor *compositor)
+{
+    ssd1306_compose_oled_frame(compositor);
+    ssd1306_send_oled_display_buffer(compositor->frame);
+}
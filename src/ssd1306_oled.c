@@ -1,95 +1,112 @@
 #include "ssd1306_oled.h"
+#include "ssd1306_bitmap_codec.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "freertos/semphr.h"
 #include "esp_err.h"
 #include "esp_log.h"
+#include <stdlib.h>
 #include <string.h>
 
 static const char *TAG = "oled_init";                                       // TAG for all the OLED LOGS
 
-static i2c_master_dev_handle_t oled_handle;                                 // I2C handle for OLED
-static i2c_master_bus_handle_t oled_master_handle;                          // I2C handle for Master Bus
+static const ssd1306_transport *oled_transport = NULL;                      // Bus the OLED is connected through
 
 static active_scroll_view *scroll_views_head = NULL;                        // Head pointer for managing linkedlist for scrolling views
 active_scroll_view **scroll_views_pointer_head = &scroll_views_head;        
 
 TaskHandle_t activate_scroll;                                               // Scrolling task handler
+static SemaphoreHandle_t scroll_views_lock = NULL;                          // Guards the scrolling views list against the scroll task
+static SemaphoreHandle_t scroll_wakeup = NULL;                              // Wakes the scroll task when a view starts scrolling
+
+// screen window in ssd1306 column / page addresses (inclusive).
+typedef struct
+{
+    uint8_t col_start;
+    uint8_t col_end;
+    uint8_t page_start;
+    uint8_t page_end;
+} oled_window;
+
+static uint8_t oled_flush_buffer[(OLED_WIDTH * OLED_PAGES) + 1];            // Transfer buffer for sending partial regions of the screen
+static uint8_t oled_stage[OLED_PAGES][OLED_WIDTH];                          // Screen space staging frame, compared with the shadow before sending
+static uint8_t oled_gddram_shadow[OLED_PAGES][OLED_WIDTH];                  // Copy of what the ssd1306 GDDRAM currently holds
+static uint8_t oled_shadow_valid_pages = 0;                                 // Bit n is set when page n of the shadow is known
+static oled_buffer *oled_hw_scroll_view = NULL;                             // View scrolled by the controller itself, one at a time
+static uint8_t oled_start_line = 0;                                         // Display start line last sent to the ssd1306
+static SemaphoreHandle_t oled_flush_lock = NULL;                            // One flush at a time, the stage and the shadow are shared
+
+static void ssd1306_flush_oled_stage(const oled_window *region);
+static void ssd1306_fill_oled_view_area(oled_buffer *oled_user_buffer, int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint8_t fill);
+static scroll_type ssd1306_release_oled_hw_scroll(oled_buffer *oled_user_buffer);
+static void ssd1306_set_oled_start_line(uint8_t line);
+static uint8_t ssd1306_oled_view_is_full_screen(const oled_buffer *oled_user_buffer);
+static void ssd1306_flush_oled_view(oled_buffer *oled_user_buffer);
+static esp_err_t ssd1306_queue_oled_front_buffer(oled_buffer *oled_user_buffer, ssd1306_transfer_done_cb done, void *user_arg);
+static uint16_t ssd1306_oled_view_soft_rows(const oled_buffer *oled_user_buffer);
+static void ssd1306_read_oled_view_rows(const oled_buffer *oled_user_buffer, uint8_t page, uint16_t col, uint16_t count, uint8_t *dst, uint16_t row_origin);
+static uint8_t ssd1306_get_oled_glyph(const font_pack *font_pack, uint32_t glyph, font_glyph *metrics);
 
 /*!
-    @brief  Initalised the OLED over the I2C protocol
-    @param  i2c_address
-            I2C address of The OLED which is the 0x3C (in hex) in most of the Cases
-    @param  sda_gpio_pin
-            I2C SDA pin number which is connected to the OLED (it is the data pin).
-    @param  scl_gpio_pin
-            I2C SCL pin number which is connetec to the OLED (it is the clock pin).
+    @brief  Initalised the OLED over the given transport
+    @param  transport
+            bus the OLED is connected through, e.g. from ssd1306_create_i2c_transport or
+            ssd1306_create_host_transport.
     @return None (Void)
     @note   This function Initalised the OLED with appropriate ssd1306 Command and
             Data as mention in the Datasheet. you can change command and desired value
             by modifing the Commands and Data in this section.
 */
-void ssd1306_init_oled_i2c(uint8_t i2c_address, uint8_t sda_gpio_pin, uint8_t scl_gpio_pin)
-{
-    // Creating the I2C Master config structure
-    i2c_master_bus_config_t i2c_mst_config = {
-        .i2c_port = I2C_PORT,
-        .scl_io_num = scl_gpio_pin,
-        .sda_io_num = sda_gpio_pin,
-        .clk_source = I2C_CLK_SRC_DEFAULT,
-        .glitch_ignore_cnt = GLITCH_IGNORE_CNT,
-        .flags.enable_internal_pullup = ENABLE_INPERRUPT_PULLUP};
-
-    // Adding the Master config to the Master handle
-    ESP_ERROR_CHECK(i2c_new_master_bus(&i2c_mst_config, &oled_master_handle));
-    ESP_LOGI(TAG, "Master Bus is created.");
-
-    // Creating the I2C device config structure ( which is the OLED here )
-    i2c_device_config_t oled_cfg = {
-        .dev_addr_length = I2C_ADDR_BIT_LEN_7,
-        .device_address = i2c_address,
-        .scl_speed_hz = I2C_SCL_SPEED,
-    };
-
-    // Adding the slave ( OLED ) config and handler to the master handler.
-    ESP_ERROR_CHECK(i2c_master_bus_add_device(oled_master_handle, &oled_cfg, &oled_handle));
-    ESP_LOGI(TAG, "Master Bus Device is added.");
-
-    // Various init command buffer for the OLED
-    // { start_command (0x00) , paticular_command ,  its value }
-
-    uint8_t init_CLK_DIV_RATIO[3] = {0x00, OLED_SET_CLOCK_DIVIDE_RATIO, 0x00};  // CLOCK DIVISION RATIO buffer set to the 0x00 for faster frequency (0x80 is prefered in most senerio)
-    uint8_t init_MUX_RATIO[3] = {0x00, OLED_SET_MULTIPLEX_RATIO, 0x3F};         // MULTIPLEX ( MUX ) RATIO set to the 0x3F ( because Display is 128x64 )
-    uint8_t init_OFFSET[3] = {0x00, OLED_SET_DISPLAY_OFFSET, 0x00};             // OFFSET set to the 0x00 ( 0 means no offset )
-    uint8_t init_CHARGE_PUMP[3] = {0x00, OLED_CHARGE_PUMP_SETTING, 0x14};       // CHARGE PUMP set to the 0x14 according to the Datasheet ( it use to drive LEDS with sufficient power by enabling 2 capacitor present )
-    uint8_t init_AUTO_ADDRESS[3] = {0x00, OLED_SET_MEMORY_ADDRESS_MODE, 0x00};  // MEMORY ADDRESS MODE set to the 0x00 which is HORIZONTAL MODE ( you can check Datasheet and change it if you want )
-    uint8_t init_COM_PIN[3] = {0x00, OLED_SET_COM_PIN, 0x12};                   // COM PIN HARDWARE CONFIGURATION set to 0x12 which is ALTERNATIVE COM ( you can check Datasheet and change it if you want )
-    uint8_t init_CONTRAST[3] = {0x00, OLED_SET_CONTRAST_CONTROL, 0x7F};         // CONTRAST set to 0x7F ( this value keep oled stable and glow biright. )
-    uint8_t init_PRECHARGED[3] = {0x00, OLED_SET_PRECHARGE_PERIOD, 0x77};       // PRE-CHARGE PERIOD set to 0xF1 ( it help the clock of OLED to work )
-    uint8_t init_VCOM_DESELECT[3] = {0x00, OLED_SET_VCOM_DESELECT_LEVEL, 0x20}; // VCOM DE-SELECT LEVEL set to 0x20 which is 0.77v * Vcc (RESET)
-    uint8_t page_set[] = {0x00, 0xB0 | 0x00, 0x00, 0x10};                       // Page START set to 0 + Column LSB/MSB  set to 0x00 / 0x10 ( make the buffer display properly otherwise it wil get display in segments )
-
-    // Sending commands in proper sequence ( the is no sequence you can send how ever you want but sometimes random sequence create problem )
+void ssd1306_init_oled(const ssd1306_transport *transport)
+{
+    if (!transport) {
+        ESP_LOGE(TAG, "No transport given for the oled.");
+        return;
+    }
+    oled_transport = transport;
+    oled_shadow_valid_pages = 0;    // GDDRAM content is unknown after power up.
+    if (!oled_flush_lock)
+        oled_flush_lock = xSemaphoreCreateMutex();
+
+    // Various init commands for the OLED, queued as { paticular_command , its value }
+    // and sent in a single transaction.
+
+    const uint8_t init_CLK_DIV_RATIO = 0x00;    // CLOCK DIVISION RATIO buffer set to the 0x00 for faster frequency (0x80 is prefered in most senerio)
+    const uint8_t init_MUX_RATIO = 0x3F;        // MULTIPLEX ( MUX ) RATIO set to the 0x3F ( because Display is 128x64 )
+    const uint8_t init_OFFSET = 0x00;           // OFFSET set to the 0x00 ( 0 means no offset )
+    const uint8_t init_CHARGE_PUMP = 0x14;      // CHARGE PUMP set to the 0x14 according to the Datasheet ( it use to drive LEDS with sufficient power by enabling 2 capacitor present )
+    const uint8_t init_AUTO_ADDRESS = 0x00;     // MEMORY ADDRESS MODE set to the 0x00 which is HORIZONTAL MODE ( you can check Datasheet and change it if you want )
+    const uint8_t init_COM_PIN = 0x12;          // COM PIN HARDWARE CONFIGURATION set to 0x12 which is ALTERNATIVE COM ( you can check Datasheet and change it if you want )
+    const uint8_t init_CONTRAST = 0x7F;         // CONTRAST set to 0x7F ( this value keep oled stable and glow biright. )
+    const uint8_t init_PRECHARGED = 0x77;       // PRE-CHARGE PERIOD set to 0xF1 ( it help the clock of OLED to work )
+    const uint8_t init_VCOM_DESELECT = 0x20;    // VCOM DE-SELECT LEVEL set to 0x20 which is 0.77v * Vcc (RESET)
+
+    // Queuing commands in proper sequence ( the is no sequence you can send how ever you want but sometimes random sequence create problem )
     // You can check Datasheet ssd1306 for checking various commands
 
-    ssd1306_send_oled_command(OLED_SET_DISPLAY_OFF);
-    ssd1306_send_oled_command(OLED_STOP_SCROLLING);
-    ssd1306_send_oled_buffer(init_CLK_DIV_RATIO, 3);
-    ssd1306_send_oled_buffer(init_MUX_RATIO, 3);
-    ssd1306_send_oled_buffer(init_OFFSET, 3);
-    ssd1306_send_oled_command(OLED_SET_DISPLAY_START_LINE);
-    ssd1306_send_oled_buffer(init_CHARGE_PUMP, 3);
-    ssd1306_send_oled_buffer(init_AUTO_ADDRESS, 3);
-    ssd1306_send_oled_buffer(page_set, sizeof(page_set));
-    ssd1306_send_oled_command(OLED_SET_SEGMENT_REMAP);
-    ssd1306_send_oled_command(OLED_SET_COM_OUTPUT_SCAN_REMAPPED);
-    ssd1306_send_oled_buffer(init_COM_PIN, 3);
-    ssd1306_send_oled_buffer(init_CONTRAST, 3);
-    ssd1306_send_oled_buffer(init_PRECHARGED, 3);
-    ssd1306_send_oled_buffer(init_VCOM_DESELECT, 3);
-    ssd1306_send_oled_command(OLED_ENTIRE_DISPLAY_ON_RAM_CONTENT);
-    ssd1306_send_oled_command(OLED_SET_NORMAL_DISPLAY);
-    ssd1306_send_oled_command(OLED_SET_DISPLAY_ON);
+    oled_command_queue queue;
+    ssd1306_begin_oled_commands(&queue);
+    ssd1306_queue_oled_command(&queue, OLED_SET_DISPLAY_OFF);
+    ssd1306_queue_oled_command(&queue, OLED_STOP_SCROLLING);
+    ssd1306_queue_oled_command_args(&queue, OLED_SET_CLOCK_DIVIDE_RATIO, &init_CLK_DIV_RATIO, 1);
+    ssd1306_queue_oled_command_args(&queue, OLED_SET_MULTIPLEX_RATIO, &init_MUX_RATIO, 1);
+    ssd1306_queue_oled_command_args(&queue, OLED_SET_DISPLAY_OFFSET, &init_OFFSET, 1);
+    ssd1306_queue_oled_command(&queue, OLED_SET_DISPLAY_START_LINE);
+    ssd1306_queue_oled_command_args(&queue, OLED_CHARGE_PUMP_SETTING, &init_CHARGE_PUMP, 1);
+    ssd1306_queue_oled_command_args(&queue, OLED_SET_MEMORY_ADDRESS_MODE, &init_AUTO_ADDRESS, 1);
+    ssd1306_queue_oled_command(&queue, OLED_SET_PAGE_START_ADDRESS | 0x00);         // Page START set to 0 + Column LSB/MSB  set to 0x00 / 0x10 ( make the buffer display properly otherwise it wil get display in segments )
+    ssd1306_queue_oled_command(&queue, OLED_SET_LOWER_COL_START_LINE);
+    ssd1306_queue_oled_command(&queue, OLED_SET_HIGHER_COL_START_LINE);
+    ssd1306_queue_oled_command(&queue, OLED_SET_SEGMENT_REMAP);
+    ssd1306_queue_oled_command(&queue, OLED_SET_COM_OUTPUT_SCAN_REMAPPED);
+    ssd1306_queue_oled_command_args(&queue, OLED_SET_COM_PIN, &init_COM_PIN, 1);
+    ssd1306_queue_oled_command_args(&queue, OLED_SET_CONTRAST_CONTROL, &init_CONTRAST, 1);
+    ssd1306_queue_oled_command_args(&queue, OLED_SET_PRECHARGE_PERIOD, &init_PRECHARGED, 1);
+    ssd1306_queue_oled_command_args(&queue, OLED_SET_VCOM_DESELECT_LEVEL, &init_VCOM_DESELECT, 1);
+    ssd1306_queue_oled_command(&queue, OLED_ENTIRE_DISPLAY_ON_RAM_CONTENT);
+    ssd1306_queue_oled_command(&queue, OLED_SET_NORMAL_DISPLAY);
+    ssd1306_queue_oled_command(&queue, OLED_SET_DISPLAY_ON);
+    ssd1306_send_oled_commands(&queue);
 
     ESP_LOGI(TAG, "oled Initialized");
 }
@@ -126,7 +143,17 @@ oled_buffer *ssd1306_create_viewbox(uint16_t width, uint8_t page)
     new_buffer->scroll_type = NO_SCROLL;
     new_buffer->oled_user_buffer[0] = 0x40;
     new_buffer->cursor = 0;
+    new_buffer->flush_mode = FLUSH_FULL;
+    new_buffer->col_origin = 0;
+    new_buffer->row_origin = 0;
+    new_buffer->draw_seq = 0;
+    new_buffer->oled_front_buffer = NULL;
+    new_buffer->flush_done = NULL;
+    new_buffer->flush_callback = NULL;
+    new_buffer->flush_callback_arg = NULL;
     memset(&new_buffer->oled_user_buffer[1], 0x00, new_buffer->oled_user_buffer_size - 1);
+    ssd1306_mark_oled_view_clean(new_buffer);
+    ssd1306_mark_oled_view_dirty(new_buffer, 0, width - 1, 0, page - 1);
     return new_buffer;
 }
 
@@ -140,6 +167,23 @@ oled_buffer *ssd1306_create_viewbox(uint16_t width, uint8_t page)
 */
 void ssd1306_delete_viewbox(oled_buffer *oled_user_buffer)
 {
+    if (oled_user_buffer->scroll_type != NO_SCROLL)
+        ssd1306_scroll_stop_oled_view(oled_user_buffer);
+    if (oled_flush_lock)
+    {
+        // views can also live without an initialised oled, e.g. as offscreen frames.
+        xSemaphoreTake(oled_flush_lock, portMAX_DELAY);
+        if (oled_user_buffer->row_origin != 0 && oled_start_line == oled_user_buffer->row_origin)
+            ssd1306_set_oled_start_line(0);
+        ssd1306_release_oled_hw_scroll(oled_user_buffer);
+        xSemaphoreGive(oled_flush_lock);
+    }
+    if (oled_user_buffer->flush_done)
+    {
+        ssd1306_wait_oled_flush(oled_user_buffer);  // the front buffer may still be on the wire.
+        vSemaphoreDelete(oled_user_buffer->flush_done);
+    }
+    free(oled_user_buffer->oled_front_buffer);
     free(oled_user_buffer->oled_user_buffer);   // free the allocated memory of the array
     free(oled_user_buffer);                     // free the allocated memory of the struct.
 }
@@ -155,14 +199,89 @@ void ssd1306_delete_viewbox(oled_buffer *oled_user_buffer)
 void ssd1306_send_oled_command(uint8_t command)
 {
     const uint8_t buffer[2] = {0x00, command};
-    ESP_ERROR_CHECK(i2c_master_probe(oled_master_handle, 0x3C, XFER_TIMEOUT_MS));
-    ESP_ERROR_CHECK(i2c_master_transmit(oled_handle, buffer, 2, XFER_TIMEOUT_MS));
+    ESP_ERROR_CHECK(oled_transport->transmit_command(oled_transport->ctx, buffer, 2));
+}
+
+
+/*!
+    @brief  start a new batch of commands.
+    @param  queue
+            command queue, usually a local variable.
+    @return None (Void)
+*/
+void ssd1306_begin_oled_commands(oled_command_queue *queue)
+{
+    queue->buffer[0] = 0x00;
+    queue->length = 1;
+}
+
+
+/*!
+    @brief  add a command with its arguments to the batch.
+    @param  queue
+            command queue started with ssd1306_begin_oled_commands.
+    @param  command
+            ssd1306 command in hex.
+    @param  args
+            arguments of the command ( can be NULL when count is 0 ).
+    @param  count
+            number of arguments.
+    @return None (Void)
+    @note   a command is never split between two transactions, if the queue has no room left
+            the commands queued so far are sent first.
+*/
+void ssd1306_queue_oled_command_args(oled_command_queue *queue, uint8_t command, const uint8_t *args, size_t count)
+{
+    if (count + 1 > OLED_COMMAND_QUEUE_SIZE - 1)
+    {
+        ESP_LOGE(TAG, "Command 0x%02X has too many arguments for the command queue.", command);
+        return;
+    }
+
+    if (queue->length + count + 1 > OLED_COMMAND_QUEUE_SIZE)
+    {
+        ssd1306_send_oled_commands(queue);
+        ssd1306_begin_oled_commands(queue);
+    }
+
+    queue->buffer[queue->length++] = command;
+    if (count)
+        memcpy(&queue->buffer[queue->length], args, count);   // commands without arguments pass args NULL.
+    queue->length += count;
+}
+
+
+/*!
+    @brief  add a command without arguments to the batch.
+    @param  queue
+            command queue started with ssd1306_begin_oled_commands.
+    @param  command
+            ssd1306 command in hex.
+    @return None (Void)
+*/
+void ssd1306_queue_oled_command(oled_command_queue *queue, uint8_t command)
+{
+    ssd1306_queue_oled_command_args(queue, command, NULL, 0);
+}
+
+
+/*!
+    @brief  send all the queued commands in a single 0x00 prefixed transaction.
+    @param  queue
+            command queue started with ssd1306_begin_oled_commands.
+    @return None (Void)
+    @note   the queue stays filled, call ssd1306_begin_oled_commands again to reuse it.
+*/
+void ssd1306_send_oled_commands(oled_command_queue *queue)
+{
+    if (queue->length > 1)
+        ssd1306_send_oled_buffer(queue->buffer, queue->length);
 }
 
 
 
 /*!
-    @brief  send a buffer to the ssd1306 over I2C
+    @brief  send a buffer to the ssd1306 over the transport
     @param  buffer
             buffer pointer containing your commands
     @param  size
@@ -174,8 +293,10 @@ void ssd1306_send_oled_command(uint8_t command)
 */
 void ssd1306_send_oled_buffer(uint8_t *buffer, size_t size)
 {
-    ESP_ERROR_CHECK(i2c_master_probe(oled_master_handle, 0x3C, XFER_TIMEOUT_MS));
-    ESP_ERROR_CHECK(i2c_master_transmit(oled_handle, buffer, size, XFER_TIMEOUT_MS));
+    if (buffer[0] == 0x40)
+        ESP_ERROR_CHECK(oled_transport->transmit_data(oled_transport->ctx, buffer, size));
+    else
+        ESP_ERROR_CHECK(oled_transport->transmit_command(oled_transport->ctx, buffer, size));
 }
 
 /*!
@@ -189,7 +310,10 @@ void ssd1306_send_oled_buffer(uint8_t *buffer, size_t size)
 */
 void ssd1306_oled_clear_view(oled_buffer *oled_user_buffer, uint8_t clear_with)
 {
+    ssd1306_begin_oled_draw(oled_user_buffer);
     memset(&oled_user_buffer->oled_user_buffer[1], clear_with, oled_user_buffer->oled_user_buffer_size - 1);
+    ssd1306_mark_oled_view_dirty(oled_user_buffer, 0, oled_user_buffer->width - 1, 0, oled_user_buffer->page - 1);
+    ssd1306_end_oled_draw(oled_user_buffer);
 }
 
 
@@ -200,18 +324,37 @@ void ssd1306_oled_clear_view(oled_buffer *oled_user_buffer, uint8_t clear_with)
             the value with which you want to clear the buffer.
     @return None (Void)
     @note   pass the value 0 or 1 in the clear_with param for fill with black and white respectively.
+            once the whole screen is known to the shadow GDDRAM, only the bytes which differ from
+            clear_with are sent.
 */
 void ssd1306_oled_clear(uint8_t clear_with)
 {
-    uint8_t page_set[4] = {0x00, 0xB0 | 0x00, 0x00, 0x10};                  // setting the start and end position of the ssd1306 ram cursor.
-    uint8_t init_CURSOR[7] = {0x00, 0x21, 0x0, 0x7F, 0x22, 0x0, 0x07};      // Setting the RAM pointer of ssd1306 to the begining
-    ssd1306_send_oled_buffer(page_set, 4);
-    ssd1306_send_oled_buffer(init_CURSOR, 7);
+    xSemaphoreTake(oled_flush_lock, portMAX_DELAY);
+    if (oled_shadow_valid_pages == 0xFF)
+    {
+        oled_window screen = {0, OLED_WIDTH - 1, 0, OLED_PAGES - 1};
+        memset(oled_stage, clear_with, sizeof(oled_stage));
+        ssd1306_flush_oled_stage(&screen);
+        xSemaphoreGive(oled_flush_lock);
+        return;
+    }
+
+    const uint8_t col_range[2] = {0x00, OLED_WIDTH - 1};                    // Setting the RAM pointer of ssd1306 to the begining
+    const uint8_t page_range[2] = {0x00, OLED_PAGES - 1};
+    oled_command_queue queue;
+    ssd1306_begin_oled_commands(&queue);
+    ssd1306_queue_oled_command(&queue, OLED_SET_PAGE_START_ADDRESS | 0x00);     // setting the start and end position of the ssd1306 ram cursor.
+    ssd1306_queue_oled_command(&queue, OLED_SET_LOWER_COL_START_LINE);
+    ssd1306_queue_oled_command(&queue, OLED_SET_HIGHER_COL_START_LINE);
+    ssd1306_queue_oled_command_args(&queue, OLED_SET_COL_ADDRESS, col_range, 2);
+    ssd1306_queue_oled_command_args(&queue, OLED_SET_PAGE_ADDRESS, page_range, 2);
+    ssd1306_send_oled_commands(&queue);
 
     // sending the temprory buffer to clear the display with desired clear_with value. 
     uint8_t *buffer = (uint8_t *)malloc(1025);
     if (!buffer) {
         ESP_LOGE(TAG, "Memory allocation failed for temprory clear buffer.");
+        xSemaphoreGive(oled_flush_lock);
         return;
     }
 
@@ -219,294 +362,1392 @@ void ssd1306_oled_clear(uint8_t clear_with)
     memset(&buffer[1], clear_with, 1024);
     ssd1306_send_oled_buffer(buffer, 1025);
     free(buffer);
+
+    // the whole GDDRAM is known from now on.
+    memset(oled_gddram_shadow, clear_with, sizeof(oled_gddram_shadow));
+    oled_shadow_valid_pages = 0xFF;
+    xSemaphoreGive(oled_flush_lock);
 }
 
 
 
 /*!
-    @brief  send the display buffer to the ssd1306 oled.
-    @param  oled_user_buffer
-             oled_buffer pointer created by the viewbox function.
+    @brief  set the ssd1306 RAM window ( column and page address ) for the next data transfer.
+    @param  start_col
+            first column of the window ( 0 - 127 ).
+    @param  end_col
+            last column of the window ( 0 - 127 ).
+    @param  start_page
+            first page of the window ( 0 - 7 ).
+    @param  end_page
+            last page of the window ( 0 - 7 ).
     @return None (Void)
-    @note   this function take the oled_buffer struct, don't pass any array in it.
 */
-void ssd1306_send_oled_display_buffer(oled_buffer *oled_user_buffer)
+static void ssd1306_set_oled_window(uint8_t start_col, uint8_t end_col, uint8_t start_page, uint8_t end_page)
 {
-
-    // defining the start and the column of the buffer.
-
-    uint8_t start_col = (uint8_t)(oled_user_buffer->col_pos - 1);
-    uint8_t end_col = (uint8_t)((oled_user_buffer->col_pos + oled_user_buffer->width) - 2);
-
-    // defining the start and the page of the buffer.
-
-    uint8_t start_page = (uint8_t)(oled_user_buffer->page_pos - 1);
-    uint8_t end_page = (uint8_t)(oled_user_buffer->page_pos + oled_user_buffer->page - 2);
-
-    // keeping the sending buffer parameter in limit.
-    end_page = end_page > 0x07 ? 0x07 : end_page;
-    end_col = end_col > 0x7f ? 0x7f : end_col;
-
-
-    uint8_t init_CURSOR[7] = {
-        0x00,
-        0x21,
-        start_col,
-        (end_col > 0x7f ? 0x7f : end_col),
-        0x22,
-        start_page,
-        (end_page > 0x07 ? 0x07 : end_page)}; // Setting the RAM pointer of ssd1306 to the begining
-    ssd1306_send_oled_buffer(init_CURSOR, 7);
-
-    ESP_ERROR_CHECK(i2c_master_transmit(oled_handle, oled_user_buffer->oled_user_buffer, oled_user_buffer->oled_user_buffer_size, XFER_TIMEOUT_MS));
-
+    const uint8_t col_range[2] = {start_col, end_col};
+    const uint8_t page_range[2] = {start_page, end_page};
+    oled_command_queue queue;
+    ssd1306_begin_oled_commands(&queue);
+    ssd1306_queue_oled_command_args(&queue, OLED_SET_COL_ADDRESS, col_range, 2);
+    ssd1306_queue_oled_command_args(&queue, OLED_SET_PAGE_ADDRESS, page_range, 2);
+    ssd1306_send_oled_commands(&queue);
 }
 
 
-
 /*!
-    @brief  place the buffer on the screen of oled at desired location.
-    @param  oled_user_buffer
-            oled_buffer pointer created by the viewbox function.
-    @param  new_col
-            it the value of the column in which you want to place viewbox
-    @param  new_page
-            it the value of the page in which you want to place viewbox
-    @return None (Void)
-    @note   it is the value of the top left corner of the viewbox, (make sure [new_col + width not exceed the 128] and [new_page + pages not exceed the 8] ).
+    @brief  bus cost of sending a window, in bytes.
+    @param  window
+            screen window.
+    @return data bytes of the window plus OLED_WINDOW_OVERHEAD_BYTES.
 */
-void ssd1306_place_oled_view(oled_buffer *oled_user_buffer, uint32_t new_col, uint32_t new_page)
+static uint32_t ssd1306_oled_window_cost(const oled_window *window)
 {
-    oled_user_buffer->col_pos = new_col;
-    oled_user_buffer->page_pos = new_page;
+    return ((window->col_end - window->col_start + 1) * (window->page_end - window->page_start + 1)) + OLED_WINDOW_OVERHEAD_BYTES;
 }
 
 
 /*!
-    @brief  put a pixel white in the oled buffer.
-    @param  oled_user_buffer
-            oled_buffer pointer created by the viewbox function.
-    @param  draw_x
-            x coordinate of the pixel.
-    @param  draw_y
-            x coordinate of the pixel.
-    @param  fill
-            '1' for fill with white and '0' for fill with black.
+    @brief  send a window of the staging frame to the ssd1306 and record it in the shadow GDDRAM.
+    @param  window
+            screen window to send.
     @return None (Void)
-    @note   Here you have to pass the coordinate of the pixel. (this function don't accept value in column and page form).
 */
-void ssd1306_draw_oled_apixel(oled_buffer *oled_user_buffer, int32_t draw_x, int32_t draw_y, uint8_t fill)
+static void ssd1306_send_oled_stage_window(const oled_window *window)
 {
+    uint32_t span = window->col_end - window->col_start + 1;
+    uint8_t *dst = &oled_flush_buffer[1];
+    oled_flush_buffer[0] = 0x40;
 
-    draw_x = draw_x - 1;
-    draw_y = draw_y - 1;
-    uint16_t page = draw_y / 8;
-    uint16_t col = (page * oled_user_buffer->width) + draw_x;
-    uint8_t page_y;
-    if(fill) page_y = oled_user_buffer->oled_user_buffer[col + 1] | (0x01 << (((uint8_t)draw_y) % 8));  // if fill is 1.
-    else page_y = oled_user_buffer->oled_user_buffer[col + 1] & ~(0x01 << (((uint8_t)draw_y) % 8));     // if fill is 0.
-    oled_user_buffer->oled_user_buffer[col + 1] = page_y;
+    // copying the window rows next to each other, as the ssd1306 expects them in horizontal mode.
+    for (int page = window->page_start; page <= window->page_end; page++)
+    {
+        memcpy(dst, &oled_stage[page][window->col_start], span);
+        memcpy(&oled_gddram_shadow[page][window->col_start], &oled_stage[page][window->col_start], span);
+        if (span == OLED_WIDTH)
+            oled_shadow_valid_pages |= (1 << page);
+        dst += span;
+    }
 
+    ssd1306_set_oled_window(window->col_start, window->col_end, window->page_start, window->page_end);
+    ssd1306_send_oled_buffer(oled_flush_buffer, dst - oled_flush_buffer);
 }
 
 
-
-
 /*!
-    @brief  add the border to your viewbox oled buffer.
-    @param  oled_user_buffer
-            oled_buffer pointer created by the viewbox function.
-    @param  up
-            '1' for border and '0' for no border.
-    @param  buttom
-            '1' for border and '0' for no border.
-    @param  left
-            '1' for border and '0' for no border.
-    @param  right
-            '1' for border and '0' for no border.
-    @return None (Void)
-    @note   the border width is a bit.
+    @brief  add a run of changed columns to the list of windows to send.
+    @param  windows
+            list of windows.
+    @param  count
+            number of windows in the list.
+    @param  page
+            page of the run.
+    @param  col_start
+            first column of the run.
+    @param  col_end
+            last column of the run.
+    @return 0 if the run did not fit in the list, 1 otherwise.
+    @note   the run grows a window that ends on the previous page when sending the extra bytes of the
+            merged rectangle is cheaper than the overhead of one more window.
 */
-void ssd1306_viewbox_oled_border(oled_buffer *oled_user_buffer, uint8_t top, uint8_t buttom, uint8_t left, uint8_t right)
+static uint8_t ssd1306_add_oled_diff_run(oled_window *windows, uint8_t *count, uint8_t page, uint8_t col_start, uint8_t col_end)
 {
+    uint32_t run_cost = (col_end - col_start + 1) + OLED_WINDOW_OVERHEAD_BYTES;
 
-    if (top)
+    for (int i = 0; i < *count; i++)
     {
-        int32_t i = 0;
-        while (i < oled_user_buffer->width)
+        oled_window *window = &windows[i];
+        if (window->page_end != page - 1)
+            continue;
+
+        oled_window merged = {
+            col_start < window->col_start ? col_start : window->col_start,
+            col_end > window->col_end ? col_end : window->col_end,
+            window->page_start,
+            page};
+
+        if (ssd1306_oled_window_cost(&merged) <= ssd1306_oled_window_cost(window) + run_cost)
         {
-            uint8_t page_y = oled_user_buffer->oled_user_buffer[i + 1] | (0xFF >> 7);
-            oled_user_buffer->oled_user_buffer[i + 1] = page_y;
-            i++;
+            *window = merged;
+            return 1;
         }
     }
 
-    if (buttom)
+    if (*count == OLED_MAX_FLUSH_WINDOWS)
+        return 0;
+
+    oled_window run = {col_start, col_end, page, page};
+    windows[(*count)++] = run;
+    return 1;
+}
+
+
+/*!
+    @brief  send the part of the staging frame which differs from the shadow GDDRAM.
+    @param  region
+            screen region of the staging frame holding new data.
+    @return None (Void)
+    @note   changed bytes are grouped into windows, a gap between two changes is sent as data when it is
+            cheaper than starting a new window, and the whole set is replaced by its bounding window when
+            that one window costs less. pages unknown to the shadow are sent completely.
+*/
+static void ssd1306_flush_oled_stage(const oled_window *region)
+{
+    oled_window windows[OLED_MAX_FLUSH_WINDOWS];
+    oled_window changed = {UINT8_MAX, 0, UINT8_MAX, 0};
+    uint8_t count = 0;
+    uint8_t overflow = 0;
+
+    for (int page = region->page_start; page <= region->page_end; page++)
     {
+        uint8_t known = oled_shadow_valid_pages & (1 << page);
+        int run_start = -1;
+        int run_end = -1;
 
-        int32_t i = 0;
-        while (i <= oled_user_buffer->width)
+        for (int col = region->col_start; col <= region->col_end; col++)
         {
-            uint16_t col = (oled_user_buffer->oled_user_buffer_size - oled_user_buffer->width) + i;
-            uint8_t page_y = oled_user_buffer->oled_user_buffer[col] | (0xFF << 7);
-            oled_user_buffer->oled_user_buffer[col] = page_y;
-            i++;
+            if (known && oled_stage[page][col] == oled_gddram_shadow[page][col])
+                continue;
+
+            if (run_start >= 0 && (col - run_end - 1) > OLED_WINDOW_OVERHEAD_BYTES)
+            {
+                overflow |= !ssd1306_add_oled_diff_run(windows, &count, page, run_start, run_end);
+                run_start = -1;
+            }
+            if (run_start < 0)
+                run_start = col;
+            run_end = col;
         }
+
+        if (run_start < 0)
+            continue;
+
+        overflow |= !ssd1306_add_oled_diff_run(windows, &count, page, run_start, run_end);
+        if (changed.page_start == UINT8_MAX)
+            changed.page_start = page;
+        changed.page_end = page;
     }
 
-    if (left)
+    if (count == 0)
+        return; // the screen already shows the staging frame.
+
+    uint32_t total_cost = 0;
+    for (int i = 0; i < count; i++)
     {
-        int32_t i = 0;
-        while (i <= oled_user_buffer->page)
-        {
-            uint8_t page_y = oled_user_buffer->oled_user_buffer[i * oled_user_buffer->width + 1] | (0xFF);
-            oled_user_buffer->oled_user_buffer[i * oled_user_buffer->width + 1] = page_y;
-            i++;
-        }
+        total_cost += ssd1306_oled_window_cost(&windows[i]);
+        if (windows[i].col_start < changed.col_start) changed.col_start = windows[i].col_start;
+        if (windows[i].col_end > changed.col_end) changed.col_end = windows[i].col_end;
     }
 
-    if (right)
+    if (overflow || ssd1306_oled_window_cost(&changed) <= total_cost)
     {
-        int32_t i = 1;
-        while (i <= oled_user_buffer->page)
-        {
-            uint8_t page_y = oled_user_buffer->oled_user_buffer[i * oled_user_buffer->width] | (0xFF);
-            oled_user_buffer->oled_user_buffer[i * oled_user_buffer->width] = page_y;
-            i++;
-        }
+        ssd1306_send_oled_stage_window(&changed);
+        return;
     }
+
+    for (int i = 0; i < count; i++)
+        ssd1306_send_oled_stage_window(&windows[i]);
 }
 
 
 /*!
-    @brief  draw circle.
+    @brief  copy the dirty region of the view into the staging frame.
     @param  oled_user_buffer
             oled_buffer pointer created by the viewbox function.
-    @param  xc
-            x coordinate of the circle center
-    @param  yc
-            y coordinate of the circle center
-    @param  r
-            radius of the circle.
-    @return None (Void)
-    @note   make sure your circle can properly draw in the buffer with the passed coordinate.
+    @param  region
+            filled with the screen region that was copied.
+    @param  whole
+            1 to copy the whole view whatever its dirty region ( FLUSH_FULL ).
+    @return 0 if there is nothing to send, 1 otherwise.
+    @note   the region is clipped to the screen and the view is marked clean.
+            the copy is a snapshot: it is dropped when a draw on the view ( see ssd1306_begin_oled_draw )
+            was running, and the view is sent again by a later flush.
 */
-void ssd1306_draw_circle(oled_buffer *buf, int xc, int yc, int r)
+static uint8_t ssd1306_stage_oled_view(oled_buffer *oled_user_buffer, oled_window *region, uint8_t whole)
 {
-    if (!buf || r <= 0)
-        return;
-
-    int x = 0, y = r;
-    int d = 3 - 2 * r;
+    // a view being drawn is left dirty for the next flush.
+    uint32_t seq = __atomic_load_n(&oled_user_buffer->draw_seq, __ATOMIC_ACQUIRE);
+    if (seq & OLED_DRAW_DEPTH_MASK)
+        return 0;
 
-    while (y >= x)
+    // taken before the copy, so a region marked while copying stays for the next flush.
+    oled_dirty_region dirty = ssd1306_take_oled_view_dirty(oled_user_buffer);
+    uint16_t soft_rows = ssd1306_oled_view_soft_rows(oled_user_buffer);
+    uint8_t moved = oled_user_buffer->col_origin != oled_user_buffer->shown_col_origin || soft_rows != oled_user_buffer->shown_row_origin;
+    if (!moved && !whole && dirty.col_start > dirty.col_end)
+        return 0; // nothing changed since the last flush.
+
+    // dirty region in view coordinates, the buffer columns are rotated by col_origin on screen.
+    int32_t view_col_start = dirty.col_start;
+    int32_t view_col_end = dirty.col_end;
+    int32_t view_page_start = dirty.page_start;
+    int32_t view_page_end = dirty.page_end;
+    if (moved || soft_rows != 0 || whole)
+    {
+        // the whole view moved on screen, or dirty rows are spread over other pages.
+        view_col_start = 0;
+        view_col_end = oled_user_buffer->width - 1;
+        view_page_start = 0;
+        view_page_end = oled_user_buffer->page - 1;
+    }
+    else if (oled_user_buffer->col_origin != 0)
     {
-        // Draw all 8 octants
-        for (int dx = -1; dx <= 1; dx += 2)
+        int32_t width = oled_user_buffer->width;
+        view_col_start = (view_col_start - oled_user_buffer->col_origin + width) % width;
+        view_col_end = (view_col_end - oled_user_buffer->col_origin + width) % width;
+        if (view_col_start > view_col_end)
         {
-            for (int dy = -1; dy <= 1; dy += 2)
-            {
-                ssd1306_draw_oled_apixel(buf, xc + dx * x, yc + dy * y, 1);
-                ssd1306_draw_oled_apixel(buf, xc + dx * y, yc + dy * x, 1);
-            }
+            // the region wraps around the origin.
+            view_col_start = 0;
+            view_col_end = width - 1;
         }
+    }
 
-        x++;
-        if (d > 0)
-        {
-            y--;
-            d = d + 4 * (x - y) + 10;
-        }
-        else
-        {
-            d = d + 4 * x + 6;
-        }
+    // screen position of the view's top left corner.
+    int32_t col_origin = (int32_t)oled_user_buffer->col_pos - 1;
+    int32_t page_origin = (int32_t)oled_user_buffer->page_pos - 1;
+
+    // clipping the region to the screen.
+    if (col_origin + view_col_start < 0) view_col_start = -col_origin;
+    if (page_origin + view_page_start < 0) view_page_start = -page_origin;
+    if (col_origin + view_col_end > OLED_WIDTH - 1) view_col_end = OLED_WIDTH - 1 - col_origin;
+    if (page_origin + view_page_end > OLED_PAGES - 1) view_page_end = OLED_PAGES - 1 - page_origin;
+
+    if (view_col_start > view_col_end || view_page_start > view_page_end)
+    {
+        ssd1306_mark_oled_view_clean(oled_user_buffer);
+        return 0; // region is outside the screen.
     }
-}
 
+    uint32_t span = view_col_end - view_col_start + 1;
+    for (int32_t page = view_page_start; page <= view_page_end; page++)
+        ssd1306_read_oled_view_rows(oled_user_buffer, page, view_col_start, span, &oled_stage[page_origin + page][col_origin + view_col_start], soft_rows);
+
+    region->col_start = col_origin + view_col_start;
+    region->col_end = col_origin + view_col_end;
+    region->page_start = page_origin + view_page_start;
+    region->page_end = page_origin + view_page_end;
+
+    ssd1306_mark_oled_view_clean(oled_user_buffer);
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    if (__atomic_load_n(&oled_user_buffer->draw_seq, __ATOMIC_RELAXED) == seq)
+        return 1;
+
+    // a draw ran while copying: the stage goes back to the screen content and the whole view is sent next time.
+    for (uint8_t page = region->page_start; page <= region->page_end; page++)
+        memcpy(&oled_stage[page][region->col_start], &oled_gddram_shadow[page][region->col_start], span);
+    oled_user_buffer->shown_col_origin = UINT16_MAX;
+    return 0;
+}
 
 
 /*!
-    @brief  draw line.
+    @brief  keep the shadow GDDRAM in step with a full view transfer.
     @param  oled_user_buffer
             oled_buffer pointer created by the viewbox function.
-    @param  x0
-            start x coordinate of the line.
-    @param  y0
-            start y coordinate of the line.
-    @param  x1
-            end x coordinate of the line.
-    @param  y1
-            end y coordinate of the line.
-    @param  fill
-            '1' for fill with white and '0' for fill with black.
     @return None (Void)
-    @note   make sure your line can properly draw in the buffer with the passed coordinate.
+    @note   a view which doesn't fit on the screen lands wrapped inside the clipped window, so the
+            pages it touched are marked unknown instead.
 */
-void ssd1306_draw_oled_line(oled_buffer *oled_user_buffer, int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint8_t fill)
+static void ssd1306_shadow_oled_view(oled_buffer *oled_user_buffer)
 {
-    int dx = abs(x1 - x0);
-    int sx = x0 < x1 ? 1 : -1;
-    int dy = -abs(y1 - y0);
-    int sy = y0 < y1 ? 1 : -1;
-    int err = dx + dy;
+    int32_t col_origin = (int32_t)oled_user_buffer->col_pos - 1;
+    int32_t page_origin = (int32_t)oled_user_buffer->page_pos - 1;
 
-    while (1)
+    if (col_origin >= 0 && page_origin >= 0 &&
+        col_origin + oled_user_buffer->width <= OLED_WIDTH &&
+        page_origin + oled_user_buffer->page <= OLED_PAGES)
     {
-        // Set the pixel at (x0, y0)
-        if (x0 >= 0 && x0 < (oled_user_buffer->width - 1) && y0 >= 0 && y0 < ((oled_user_buffer->page - 1) * 8))
-        {
-            uint16_t index = x0 + (y0 / 8) * (oled_user_buffer->width);
-            if (fill)
-                oled_user_buffer->oled_user_buffer[index + 1] |= (1 << (y0 % 8));
-            else
-                oled_user_buffer->oled_user_buffer[index + 1] &= ~(1 << (y0 % 8));
-        }
-
-        if (x0 == x1 && y0 == y1)
-            break;
-
-        int e2 = 2 * err;
-        if (e2 >= dy)
-        {
-            err += dy;
-            x0 += sx;
-        }
-        if (e2 <= dx)
-        {
-            err += dx;
-            y0 += sy;
-        }
+        for (int page = 0; page < oled_user_buffer->page; page++)
+            ssd1306_read_oled_view_rows(oled_user_buffer, page, 0, oled_user_buffer->width, &oled_gddram_shadow[page_origin + page][col_origin], ssd1306_oled_view_soft_rows(oled_user_buffer));
+        return;
     }
+
+    for (int32_t page = page_origin; page < page_origin + oled_user_buffer->page; page++)
+        if (page >= 0 && page < OLED_PAGES)
+            oled_shadow_valid_pages &= ~(1 << page);
 }
 
 
 /*!
-    @brief  stop the scrolling in the ssd1306.
+    @brief  set the ssd1306 RAM window to the area covered by the whole view.
+    @param  oled_user_buffer
+            oled_buffer pointer created by the viewbox function.
     @return None (Void)
-    @note   this stop scrolling which is done by the ssd1306 itself.
 */
-void ssd1306_scroll_oled_stop(void)
+static void ssd1306_set_oled_view_window(oled_buffer *oled_user_buffer)
 {
-    ssd1306_send_oled_command(0x2E);
-}
+    // defining the start and the column of the buffer.
+
+    uint8_t start_col = (uint8_t)(oled_user_buffer->col_pos - 1);
+    uint8_t end_col = (uint8_t)((oled_user_buffer->col_pos + oled_user_buffer->width) - 2);
+
+    // defining the start and the page of the buffer.
+
+    uint8_t start_page = (uint8_t)(oled_user_buffer->page_pos - 1);
+    uint8_t end_page = (uint8_t)(oled_user_buffer->page_pos + oled_user_buffer->page - 2);
+
+    // keeping the sending buffer parameter in limit.
+    end_page = end_page > 0x07 ? 0x07 : end_page;
+    end_col = end_col > 0x7f ? 0x7f : end_col;
 
+    ssd1306_set_oled_window(start_col, end_col, start_page, end_page);  // Setting the RAM pointer of ssd1306 to the begining
+}
 
 
 /*!
-    @brief  this init your font array so that you can use it with this library.
-    @param  font_array
-            pointer of  font array.
-    @param  width
-            width of the font.
-    @param  height
-           height of the font.
-    @param  offset
-            it is use to manage the conversion of the ASCI value and its font position in array.
-    @return font_pack struct.
-    @note   currently this library don't support custom font. so use the 5x8 font provided with this library.
+    @brief  send the display buffer to the ssd1306 oled.
+    @param  oled_user_buffer
+             oled_buffer pointer created by the viewbox function.
+    @return None (Void)
+    @note   this function take the oled_buffer struct, don't pass any array in it.
+            with FLUSH_DIRTY mode only the region changed since the last flush is sent, with FLUSH_DIFF
+            the changed region is further compared with the shadow GDDRAM and only the bytes which
+            really differ from the screen are sent.
+            a view scrolled by the controller is handed over to the scroll task first ( see ssd1306_scroll_oled_view ).
 */
-font_pack *ssd1306_init_oled_font(const uint8_t *font_array, uint8_t width, uint8_t height, uint8_t offset)
+void ssd1306_send_oled_display_buffer(oled_buffer *oled_user_buffer)
+{
+    xSemaphoreTake(oled_flush_lock, portMAX_DELAY);
+    scroll_type handover = ssd1306_release_oled_hw_scroll(oled_user_buffer);
+    ssd1306_flush_oled_view(oled_user_buffer);
+    xSemaphoreGive(oled_flush_lock);
+
+    if (handover != NO_SCROLL)
+        ssd1306_scroll_oled_view_rate(oled_user_buffer, handover, OLED_SCROLL_PERIOD_MS, 1);
+}
+
+
+/*!
+    @brief  send the display buffer, the flush lock is already held.
+    @param  oled_user_buffer
+            oled_buffer pointer created by the viewbox function.
+    @return None (Void)
+*/
+static void ssd1306_flush_oled_view(oled_buffer *oled_user_buffer)
+{
+    if (oled_user_buffer->row_origin != oled_start_line && ssd1306_oled_view_is_full_screen(oled_user_buffer))
+        ssd1306_set_oled_start_line(oled_user_buffer->row_origin);
+
+    if (oled_user_buffer->flush_mode != FLUSH_FULL)
+    {
+        oled_window region;
+        if (!ssd1306_stage_oled_view(oled_user_buffer, &region, 0))
+            return;
+
+        if (oled_user_buffer->flush_mode == FLUSH_DIFF)
+            ssd1306_flush_oled_stage(&region);
+        else
+            ssd1306_send_oled_stage_window(&region);
+        return;
+    }
+
+    // the whole view is copied in screen order through the stage, which is only sent when no draw
+    // ran during the copy. a view being drawn keeps the screen content until its next flush.
+    oled_window region;
+    if (ssd1306_stage_oled_view(oled_user_buffer, &region, 1))
+        ssd1306_send_oled_stage_window(&region);
+}
+
+
+/*!
+    @brief  completion of an asynchronous view transfer.
+    @param  user_arg
+            oled_buffer pointer of the view.
+    @return true if a higher priority task was woken, the bus driver yields on its way out of the interrupt.
+    @note   called by the transport, usually from the bus interrupt.
+*/
+static bool ssd1306_oled_flush_done_isr(void *user_arg)
+{
+    oled_buffer *oled_user_buffer = (oled_buffer *)user_arg;
+    BaseType_t task_woken = pdFALSE;
+    bool callback_woken = false;
+
+    if (oled_user_buffer->flush_callback)
+        callback_woken = oled_user_buffer->flush_callback(oled_user_buffer->flush_callback_arg);
+    xSemaphoreGiveFromISR(oled_user_buffer->flush_done, &task_woken);
+    return callback_woken || task_woken == pdTRUE;
+}
+
+
+/*!
+    @brief  allocate the front buffer and the completion semaphore of a view.
+    @param  oled_user_buffer
+            oled_buffer pointer created by the viewbox function.
+    @return ESP_OK on success, ESP_ERR_NO_MEM otherwise.
+*/
+static esp_err_t ssd1306_create_oled_front_buffer(oled_buffer *oled_user_buffer)
+{
+    oled_user_buffer->oled_front_buffer = malloc(oled_user_buffer->oled_user_buffer_size);
+    oled_user_buffer->flush_done = xSemaphoreCreateBinary();
+    if (!oled_user_buffer->oled_front_buffer || !oled_user_buffer->flush_done)
+    {
+        ESP_LOGE(TAG, "Memory allocation failed for the front buffer of the view.");
+        free(oled_user_buffer->oled_front_buffer);
+        if (oled_user_buffer->flush_done)
+            vSemaphoreDelete(oled_user_buffer->flush_done);
+        oled_user_buffer->oled_front_buffer = NULL;
+        oled_user_buffer->flush_done = NULL;
+        return ESP_ERR_NO_MEM;
+    }
+
+    memcpy(oled_user_buffer->oled_front_buffer, oled_user_buffer->oled_user_buffer, oled_user_buffer->oled_user_buffer_size);
+    xSemaphoreGive(oled_user_buffer->flush_done);   // no transfer in flight yet.
+    return ESP_OK;
+}
+
+
+/*!
+    @brief  send the display buffer to the ssd1306 oled without waiting for the transfer.
+    @param  oled_user_buffer
+            oled_buffer pointer created by the viewbox function.
+    @param  done
+            called once the frame is on the panel, can be NULL. it runs in interrupt context with an
+            asynchronous transport ( the I2C transaction done interrupt ), so it must be short, only use
+            FromISR calls and return true when it woke a higher priority task.
+    @param  user_arg
+            argument for the done callback.
+    @return ESP_OK on success, ESP_ERR_NO_MEM if the front buffer can't be allocated, ESP_ERR_INVALID_STATE
+            if a draw ( see ssd1306_begin_oled_draw ) ran during the copy: nothing is sent, done isn't
+            called and the whole view goes out with the next flush.
+    @note   the view is double buffered: the frame is copied in screen order into the front buffer and
+            handed to the bus, while oled_user_buffer can be drawn at once. only a previous asynchronous
+            transfer of the same view is waited for. the whole view is sent, its flush mode is ignored.
+            without async support in the transport the transfer is blocking.
+            a view scrolled by the controller is handed over to the scroll task first ( see ssd1306_scroll_oled_view ).
+*/
+esp_err_t ssd1306_send_oled_display_buffer_async(oled_buffer *oled_user_buffer, ssd1306_transfer_done_cb done, void *user_arg)
+{
+    if (!oled_user_buffer->oled_front_buffer && ssd1306_create_oled_front_buffer(oled_user_buffer) != ESP_OK)
+        return ESP_ERR_NO_MEM;
+
+    // waiting for the previous frame of this view to leave the front buffer.
+    xSemaphoreTake(oled_user_buffer->flush_done, portMAX_DELAY);
+    xSemaphoreTake(oled_flush_lock, portMAX_DELAY);
+    scroll_type handover = ssd1306_release_oled_hw_scroll(oled_user_buffer);
+
+    if (oled_user_buffer->row_origin != oled_start_line && ssd1306_oled_view_is_full_screen(oled_user_buffer))
+        ssd1306_set_oled_start_line(oled_user_buffer->row_origin);
+
+    // the frame is copied in screen order into the front buffer, which is the snapshot on the wire.
+    uint8_t *frame = oled_user_buffer->oled_front_buffer;
+    uint32_t seq = __atomic_load_n(&oled_user_buffer->draw_seq, __ATOMIC_ACQUIRE);
+    if (!(seq & OLED_DRAW_DEPTH_MASK))
+    {
+        // cleaning before the copy, so a region marked while copying stays for the next flush.
+        ssd1306_mark_oled_view_clean(oled_user_buffer);
+        for (int page = 0; page < oled_user_buffer->page; page++)
+            ssd1306_read_oled_view_rows(oled_user_buffer, page, 0, oled_user_buffer->width, &frame[(page * oled_user_buffer->width) + 1], ssd1306_oled_view_soft_rows(oled_user_buffer));
+        __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    }
+
+    esp_err_t result;
+    if ((seq & OLED_DRAW_DEPTH_MASK) || __atomic_load_n(&oled_user_buffer->draw_seq, __ATOMIC_RELAXED) != seq)
+    {
+        // the copy may be torn, it is dropped and the whole view is sent by the next flush.
+        oled_user_buffer->shown_col_origin = UINT16_MAX;
+        xSemaphoreGive(oled_flush_lock);
+        xSemaphoreGive(oled_user_buffer->flush_done);
+        result = ESP_ERR_INVALID_STATE;
+    }
+    else
+        result = ssd1306_queue_oled_front_buffer(oled_user_buffer, done, user_arg);
+
+    if (handover != NO_SCROLL)
+        ssd1306_scroll_oled_view_rate(oled_user_buffer, handover, OLED_SCROLL_PERIOD_MS, 1);
+    return result;
+}
+
+
+/*!
+    @brief  hand the front buffer of the view to the bus, the flush lock is already held.
+    @param  oled_user_buffer
+            oled_buffer pointer created by the viewbox function, its front buffer holds an untorn frame.
+    @param  done
+            called once the frame is on the panel, can be NULL.
+    @param  user_arg
+            argument for the done callback.
+    @return ESP_OK.
+    @note   the flush lock and, once the transfer is finished, the flush_done semaphore of the view are given back.
+*/
+static esp_err_t ssd1306_queue_oled_front_buffer(oled_buffer *oled_user_buffer, ssd1306_transfer_done_cb done, void *user_arg)
+{
+    uint8_t *frame = oled_user_buffer->oled_front_buffer;
+    ssd1306_set_oled_view_window(oled_user_buffer);
+
+    // the shadow follows what is on the wire.
+    int32_t col_origin = (int32_t)oled_user_buffer->col_pos - 1;
+    int32_t page_origin = (int32_t)oled_user_buffer->page_pos - 1;
+    if (col_origin >= 0 && page_origin >= 0 &&
+        col_origin + oled_user_buffer->width <= OLED_WIDTH &&
+        page_origin + oled_user_buffer->page <= OLED_PAGES)
+    {
+        for (int page = 0; page < oled_user_buffer->page; page++)
+            memcpy(&oled_gddram_shadow[page_origin + page][col_origin], &frame[(page * oled_user_buffer->width) + 1], oled_user_buffer->width);
+    }
+    else
+        ssd1306_shadow_oled_view(oled_user_buffer);
+
+    oled_user_buffer->flush_callback = done;
+    oled_user_buffer->flush_callback_arg = user_arg;
+
+    // the lock is held until the data is queued, bus transactions are sent in order so a later
+    // flush can't move the window under this frame.
+    if (oled_transport->transmit_data_async)
+    {
+        ESP_ERROR_CHECK(oled_transport->transmit_data_async(oled_transport->ctx, frame, oled_user_buffer->oled_user_buffer_size, ssd1306_oled_flush_done_isr, oled_user_buffer));
+        xSemaphoreGive(oled_flush_lock);
+    }
+    else
+    {
+        ESP_ERROR_CHECK(oled_transport->transmit_data(oled_transport->ctx, frame, oled_user_buffer->oled_user_buffer_size));
+        xSemaphoreGive(oled_flush_lock);
+        if (done)
+            done(user_arg);
+        xSemaphoreGive(oled_user_buffer->flush_done);
+    }
+    return ESP_OK;
+}
+
+
+/*!
+    @brief  wait until the asynchronous transfer of the view is finished.
+    @param  oled_user_buffer
+            oled_buffer pointer created by the viewbox function.
+    @return None (Void)
+    @note   returns at once if the view never used ssd1306_send_oled_display_buffer_async.
+*/
+void ssd1306_wait_oled_flush(oled_buffer *oled_user_buffer)
+{
+    if (!oled_user_buffer->flush_done)
+        return;
+
+    xSemaphoreTake(oled_user_buffer->flush_done, portMAX_DELAY);
+    xSemaphoreGive(oled_user_buffer->flush_done);
+}
+
+
+/*!
+    @brief  select how the view is sent by ssd1306_send_oled_display_buffer.
+    @param  oled_user_buffer
+            oled_buffer pointer created by the viewbox function.
+    @param  mode
+            FLUSH_FULL to send the whole view, FLUSH_DIRTY to send only the changed region.
+    @return None (Void)
+    @note   FLUSH_DIRTY only knows about changes made through the library functions, if you write
+            into oled_user_buffer directly then mark the region with ssd1306_mark_oled_view_dirty.
+*/
+void ssd1306_set_oled_flush_mode(oled_buffer *oled_user_buffer, flush_mode mode)
+{
+    oled_user_buffer->flush_mode = mode;
+}
+
+
+/*!
+    @brief  add a region to the dirty region of the view.
+    @param  oled_user_buffer
+            oled_buffer pointer created by the viewbox function.
+    @param  col_start
+            first changed column of the view.
+    @param  col_end
+            last changed column of the view.
+    @param  page_start
+            first changed page of the view.
+    @param  page_end
+            last changed page of the view.
+    @return None (Void)
+    @note   the region is clipped to the view and merged with the existing dirty region into one bounding box.
+            the merge is atomic, a flush from another task taking the region never loses it.
+*/
+void ssd1306_mark_oled_view_dirty(oled_buffer *oled_user_buffer, int32_t col_start, int32_t col_end, int32_t page_start, int32_t page_end)
+{
+    if (col_start < 0) col_start = 0;
+    if (page_start < 0) page_start = 0;
+    if (col_end > oled_user_buffer->width - 1) col_end = oled_user_buffer->width - 1;
+    if (page_end > oled_user_buffer->page - 1) page_end = oled_user_buffer->page - 1;
+    if (col_start > col_end || page_start > page_end)
+        return;
+
+    // a clean view holds an inverted (empty) box, so min / max always give the union.
+    oled_dirty_region seen, merged;
+    seen.word = __atomic_load_n(&oled_user_buffer->dirty.word, __ATOMIC_RELAXED);
+    do
+    {
+        merged = seen;
+        if (col_start < merged.col_start) merged.col_start = col_start;
+        if (col_end > merged.col_end) merged.col_end = col_end;
+        if (page_start < merged.page_start) merged.page_start = page_start;
+        if (page_end > merged.page_end) merged.page_end = page_end;
+        if (merged.word == seen.word)
+            return; // already inside the dirty region.
+    } while (!__atomic_compare_exchange_n(&oled_user_buffer->dirty.word, &seen.word, merged.word, 1, __ATOMIC_RELEASE, __ATOMIC_RELAXED));
+}
+
+
+/*!
+    @brief  reset the dirty region of the view.
+    @param  oled_user_buffer
+            oled_buffer pointer created by the viewbox function.
+    @return None (Void)
+    @note   the screen is taken as showing the current origins of the view.
+*/
+void ssd1306_mark_oled_view_clean(oled_buffer *oled_user_buffer)
+{
+    ssd1306_take_oled_view_dirty(oled_user_buffer);
+    oled_user_buffer->shown_col_origin = oled_user_buffer->col_origin;
+    oled_user_buffer->shown_row_origin = ssd1306_oled_view_soft_rows(oled_user_buffer);
+}
+
+
+/*!
+    @brief  read the dirty region of the view.
+    @param  oled_user_buffer
+            oled_buffer pointer created by the viewbox function.
+    @return the dirty region, empty when col_start > col_end.
+*/
+oled_dirty_region ssd1306_get_oled_view_dirty(const oled_buffer *oled_user_buffer)
+{
+    oled_dirty_region region;
+    region.word = __atomic_load_n(&oled_user_buffer->dirty.word, __ATOMIC_ACQUIRE);
+    return region;
+}
+
+
+/*!
+    @brief  read the dirty region of the view and leave the view clean, in one atomic step.
+    @param  oled_user_buffer
+            oled_buffer pointer created by the viewbox function.
+    @return the dirty region, empty when col_start > col_end.
+    @note   regions marked by a draw after the call stay for the next one.
+*/
+oled_dirty_region ssd1306_take_oled_view_dirty(oled_buffer *oled_user_buffer)
+{
+    const oled_dirty_region clean = {{UINT8_MAX, 0, UINT8_MAX, 0}};
+    oled_dirty_region region;
+    region.word = __atomic_exchange_n(&oled_user_buffer->dirty.word, clean.word, __ATOMIC_ACQ_REL);
+    return region;
+}
+
+
+/*!
+    @brief  copy a row of the view with the given vertical origin.
+    @param  oled_user_buffer
+            oled_buffer pointer created by the viewbox function.
+    @param  page
+            page of the view on screen.
+    @param  col
+            first column, counted from the left edge of the view on screen.
+    @param  count
+            number of columns ( col + count <= width ).
+    @param  dst
+            destination of the bytes.
+    @param  row_origin
+            buffer row shown on the top row of the view.
+    @return None (Void)
+    @note   a scrolled view keeps its bytes in place and only moves its origins, so the row is read
+            as at most two spans around col_origin, and bytes straddling two pages are put together
+            when the row origin is not a multiple of 8.
+*/
+static void ssd1306_read_oled_view_rows(const oled_buffer *oled_user_buffer, uint8_t page, uint16_t col, uint16_t count, uint8_t *dst, uint16_t row_origin)
+{
+    uint32_t width = oled_user_buffer->width;
+    uint32_t src_page = (page + (row_origin / 8)) % oled_user_buffer->page;
+    uint32_t bits = row_origin % 8;
+    const uint8_t *row = &oled_user_buffer->oled_user_buffer[(src_page * width) + 1];
+    uint32_t start = col + oled_user_buffer->col_origin;
+    if (start >= width)
+        start -= width;
+
+    if (bits == 0)
+    {
+        uint32_t first = width - start;
+        if (first >= count)
+        {
+            memcpy(dst, &row[start], count);
+            return;
+        }
+
+        memcpy(dst, &row[start], first);
+        memcpy(&dst[first], row, count - first);
+        return;
+    }
+
+    const uint8_t *next = &oled_user_buffer->oled_user_buffer[(((src_page + 1) % oled_user_buffer->page) * width) + 1];
+    for (uint32_t i = 0; i < count; i++)
+    {
+        dst[i] = (row[start] >> bits) | (next[start] << (8 - bits));
+        if (++start == width)
+            start = 0;
+    }
+}
+
+
+/*!
+    @brief  copy a row of the view in the order it appears on the screen.
+    @param  oled_user_buffer
+            oled_buffer pointer created by the viewbox function.
+    @param  page
+            page of the view.
+    @param  col
+            first column, counted from the left edge of the view on screen.
+    @param  count
+            number of columns ( col + count <= width ).
+    @param  dst
+            destination of the bytes.
+    @return None (Void)
+    @note   both origins of a scrolled view are applied.
+*/
+void ssd1306_read_oled_view_span(const oled_buffer *oled_user_buffer, uint8_t page, uint16_t col, uint16_t count, uint8_t *dst)
+{
+    ssd1306_read_oled_view_rows(oled_user_buffer, page, col, count, dst, oled_user_buffer->row_origin);
+}
+
+
+/*!
+    @brief  mark the start of a drawing on the view.
+    @param  oled_user_buffer
+            oled_buffer pointer created by the viewbox function.
+    @return None (Void)
+    @note   the draw functions of this library do it on their own, call it around a group of draws
+            ( e.g. a whole line of text ) which must only reach the screen together.
+            it never blocks: a flush from another task skips the view until ssd1306_end_oled_draw.
+            calls can be nested, also from several tasks, the view is busy until the last one ends.
+*/
+void ssd1306_begin_oled_draw(oled_buffer *oled_user_buffer)
+{
+    __atomic_fetch_add(&oled_user_buffer->draw_seq, 1, __ATOMIC_SEQ_CST);
+}
+
+
+/*!
+    @brief  mark the end of a drawing on the view.
+    @param  oled_user_buffer
+            oled_buffer pointer created by the viewbox function.
+    @return None (Void)
+*/
+void ssd1306_end_oled_draw(oled_buffer *oled_user_buffer)
+{
+    // one step takes the draw off the depth and counts it as ended, so a flush sees any draw in between.
+    __atomic_fetch_add(&oled_user_buffer->draw_seq, OLED_DRAW_ENDED - 1, __ATOMIC_RELEASE);
+}
+
+
+/*!
+    @brief  scroll the view horizontally by moving its origin, the buffer itself is not touched.
+    @param  oled_user_buffer
+            oled_buffer pointer created by the viewbox function.
+    @param  columns
+            columns to move the content by, positive to the left and negative to the right.
+    @return None (Void)
+    @note   the content wraps around the view, the whole view is marked dirty.
+            the origin changes under the flush lock, so a flush never copies the view half moved.
+*/
+void ssd1306_rotate_oled_view(oled_buffer *oled_user_buffer, int32_t columns)
+{
+    int32_t width = oled_user_buffer->width;
+
+    xSemaphoreTake(oled_flush_lock, portMAX_DELAY);
+    oled_user_buffer->col_origin = (oled_user_buffer->col_origin + (columns % width) + width) % width;
+    ssd1306_mark_oled_view_dirty(oled_user_buffer, 0, width - 1, 0, oled_user_buffer->page - 1);
+    xSemaphoreGive(oled_flush_lock);
+}
+
+
+
+/*!
+    @brief  place the buffer on the screen of oled at desired location.
+    @param  oled_user_buffer
+            oled_buffer pointer created by the viewbox function.
+    @param  new_col
+            it the value of the column in which you want to place viewbox
+    @param  new_page
+            it the value of the page in which you want to place viewbox
+    @return None (Void)
+    @note   it is the value of the top left corner of the viewbox, (make sure [new_col + width not exceed the 128] and [new_page + pages not exceed the 8] ).
+*/
+void ssd1306_place_oled_view(oled_buffer *oled_user_buffer, uint32_t new_col, uint32_t new_page)
+{
+    oled_user_buffer->col_pos = new_col;
+    oled_user_buffer->page_pos = new_page;
+    ssd1306_mark_oled_view_dirty(oled_user_buffer, 0, oled_user_buffer->width - 1, 0, oled_user_buffer->page - 1);
+}
+
+
+/*!
+    @brief  put a pixel white in the oled buffer.
+    @param  oled_user_buffer
+            oled_buffer pointer created by the viewbox function.
+    @param  draw_x
+            x coordinate of the pixel.
+    @param  draw_y
+            x coordinate of the pixel.
+    @param  fill
+            '1' for fill with white and '0' for fill with black.
+    @return None (Void)
+    @note   Here you have to pass the coordinate of the pixel. (this function don't accept value in column and page form).
+*/
+void ssd1306_draw_oled_apixel(oled_buffer *oled_user_buffer, int32_t draw_x, int32_t draw_y, uint8_t fill)
+{
+    ssd1306_begin_oled_draw(oled_user_buffer);
+    draw_x = draw_x - 1;
+    draw_y = draw_y - 1;
+    uint16_t page = draw_y / 8;
+    uint16_t col = (page * oled_user_buffer->width) + draw_x;
+    uint8_t page_y;
+    if(fill) page_y = oled_user_buffer->oled_user_buffer[col + 1] | (0x01 << (((uint8_t)draw_y) % 8));  // if fill is 1.
+    else page_y = oled_user_buffer->oled_user_buffer[col + 1] & ~(0x01 << (((uint8_t)draw_y) % 8));     // if fill is 0.
+    oled_user_buffer->oled_user_buffer[col + 1] = page_y;
+    ssd1306_mark_oled_view_dirty(oled_user_buffer, draw_x, draw_x, page, page);
+    ssd1306_end_oled_draw(oled_user_buffer);
+}
+
+
+
+
+/*!
+    @brief  add the border to your viewbox oled buffer.
+    @param  oled_user_buffer
+            oled_buffer pointer created by the viewbox function.
+    @param  up
+            '1' for border and '0' for no border.
+    @param  buttom
+            '1' for border and '0' for no border.
+    @param  left
+            '1' for border and '0' for no border.
+    @param  right
+            '1' for border and '0' for no border.
+    @return None (Void)
+    @note   the border width is a bit.
+*/
+void ssd1306_viewbox_oled_border(oled_buffer *oled_user_buffer, uint8_t top, uint8_t buttom, uint8_t left, uint8_t right)
+{
+    int32_t last_col = oled_user_buffer->width - 1;
+    int32_t last_row = (oled_user_buffer->page * 8) - 1;
+
+    ssd1306_begin_oled_draw(oled_user_buffer);
+    if (top) ssd1306_fill_oled_view_area(oled_user_buffer, 0, 0, last_col, 0, 1);
+    if (buttom) ssd1306_fill_oled_view_area(oled_user_buffer, 0, last_row, last_col, last_row, 1);
+    if (left) ssd1306_fill_oled_view_area(oled_user_buffer, 0, 0, 0, last_row, 1);
+    if (right) ssd1306_fill_oled_view_area(oled_user_buffer, last_col, 0, last_col, last_row, 1);
+    ssd1306_end_oled_draw(oled_user_buffer);
+}
+
+
+/*!
+    @brief  draw circle.
+    @param  oled_user_buffer
+            oled_buffer pointer created by the viewbox function.
+    @param  xc
+            x coordinate of the circle center ( 1 based, as ssd1306_draw_oled_apixel ).
+    @param  yc
+            y coordinate of the circle center ( 1 based ).
+    @param  r
+            radius of the circle.
+    @return None (Void)
+    @note   the circle is clipped to the view, see ssd1306_draw_oled_circle for 0 based coordinates and black circles.
+*/
+void ssd1306_draw_circle(oled_buffer *buf, int xc, int yc, int r)
+{
+    if (!buf || r <= 0)
+        return;
+
+    ssd1306_draw_oled_circle(buf, xc - 1, yc - 1, r, 1);
+}
+
+
+
+/*!
+    @brief  fill a rectangle of the view, the span primitive of the line and shape functions.
+    @param  oled_user_buffer
+            oled_buffer pointer created by the viewbox function.
+    @param  x0
+            left column ( 0 based ).
+    @param  y0
+            top row ( 0 based ).
+    @param  x1
+            right column, included.
+    @param  y1
+            bottom row, included.
+    @param  fill
+            '1' for fill with white and '0' for fill with black.
+    @return None (Void)
+    @note   the rectangle is clipped to the view. every page it covers gets one byte mask, pages
+            covered entirely are memset and the top / bottom ones are masked across the row.
+*/
+static void ssd1306_fill_oled_view_area(oled_buffer *oled_user_buffer, int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint8_t fill)
+{
+    if (x0 < 0) x0 = 0;
+    if (y0 < 0) y0 = 0;
+    if (x1 > oled_user_buffer->width - 1) x1 = oled_user_buffer->width - 1;
+    if (y1 > (oled_user_buffer->page * 8) - 1) y1 = (oled_user_buffer->page * 8) - 1;
+    if (x0 > x1 || y0 > y1)
+        return;
+
+    int32_t page_start = y0 / 8;
+    int32_t page_end = y1 / 8;
+    int32_t span = x1 - x0 + 1;
+
+    for (int32_t page = page_start; page <= page_end; page++)
+    {
+        uint8_t mask = 0xFF;
+        if (page == page_start) mask &= 0xFF << (y0 % 8);
+        if (page == page_end) mask &= 0xFF >> (7 - (y1 % 8));
+
+        uint8_t *row = &oled_user_buffer->oled_user_buffer[(page * oled_user_buffer->width) + x0 + 1];
+        if (mask == 0xFF)
+            memset(row, fill ? 0xFF : 0x00, span);
+        else if (fill)
+            for (int32_t i = 0; i < span; i++)
+                row[i] |= mask;
+        else
+            for (int32_t i = 0; i < span; i++)
+                row[i] &= ~mask;
+    }
+    ssd1306_mark_oled_view_dirty(oled_user_buffer, x0, x1, page_start, page_end);
+}
+
+
+/*!
+    @brief  draw a filled rectangle.
+    @param  oled_user_buffer
+            oled_buffer pointer created by the viewbox function.
+    @param  x
+            left column of the rectangle ( 0 based, as ssd1306_draw_oled_line ).
+    @param  y
+            top row of the rectangle.
+    @param  width
+            width of the rectangle.
+    @param  height
+            height of the rectangle.
+    @param  fill
+            '1' for fill with white and '0' for fill with black.
+    @return None (Void)
+    @note   the rectangle is clipped to the view, so it can be used for bar graphs growing past the edges.
+*/
+void ssd1306_fill_oled_rect(oled_buffer *oled_user_buffer, int32_t x, int32_t y, int32_t width, int32_t height, uint8_t fill)
+{
+    if (width <= 0 || height <= 0)
+        return;
+
+    ssd1306_begin_oled_draw(oled_user_buffer);
+    ssd1306_fill_oled_view_area(oled_user_buffer, x, y, x + width - 1, y + height - 1, fill);
+    ssd1306_end_oled_draw(oled_user_buffer);
+}
+
+
+/*!
+    @brief  draw the outline of a rectangle.
+    @param  oled_user_buffer
+            oled_buffer pointer created by the viewbox function.
+    @param  x
+            left column of the rectangle ( 0 based, as ssd1306_draw_oled_line ).
+    @param  y
+            top row of the rectangle.
+    @param  width
+            width of the rectangle.
+    @param  height
+            height of the rectangle.
+    @param  fill
+            '1' for fill with white and '0' for fill with black.
+    @return None (Void)
+    @note   the outline is one pixel wide and clipped to the view.
+*/
+void ssd1306_draw_oled_rect(oled_buffer *oled_user_buffer, int32_t x, int32_t y, int32_t width, int32_t height, uint8_t fill)
+{
+    if (width <= 0 || height <= 0)
+        return;
+
+    int32_t x1 = x + width - 1;
+    int32_t y1 = y + height - 1;
+
+    ssd1306_begin_oled_draw(oled_user_buffer);
+    ssd1306_fill_oled_view_area(oled_user_buffer, x, y, x1, y, fill);
+    ssd1306_fill_oled_view_area(oled_user_buffer, x, y1, x1, y1, fill);
+    ssd1306_fill_oled_view_area(oled_user_buffer, x, y, x, y1, fill);
+    ssd1306_fill_oled_view_area(oled_user_buffer, x1, y, x1, y1, fill);
+    ssd1306_end_oled_draw(oled_user_buffer);
+}
+
+
+/*!
+    @brief  draw a shape made of four quarter ellipses joined by straight edges as horizontal spans.
+    @param  oled_user_buffer
+            oled_buffer pointer created by the viewbox function.
+    @param  cx_left
+            x of the center of the left quarters.
+    @param  cx_right
+            x of the center of the right quarters ( cx_left for an ellipse ).
+    @param  cy_top
+            y of the center of the top quarters.
+    @param  cy_bottom
+            y of the center of the bottom quarters ( cy_top for an ellipse ).
+    @param  rx
+            horizontal radius of the quarters.
+    @param  ry
+            vertical radius of the quarters.
+    @param  filled
+            1 to fill the shape, 0 for its one pixel outline.
+    @param  fill
+            '1' for fill with white and '0' for fill with black.
+    @return None (Void)
+    @note   the half width of every row comes from a midpoint walk down the quarter: x only shrinks while
+            ( x, dy ) is outside the ellipse of radii rx + 1/2, ry + 1/2. an outline row spans from its half
+            width to the half width of the next row, so steep parts of the curve stay connected.
+*/
+static void ssd1306_draw_oled_quarters(oled_buffer *oled_user_buffer, int32_t cx_left, int32_t cx_right, int32_t cy_top, int32_t cy_bottom,
+                                       int32_t rx, int32_t ry, uint8_t filled, uint8_t fill)
+{
+    // inside when 4 x^2 (2ry + 1)^2 + 4 dy^2 (2rx + 1)^2 <= (2rx + 1)^2 (2ry + 1)^2.
+    int64_t ax = (int64_t)(2 * rx + 1) * (2 * rx + 1);
+    int64_t by = (int64_t)(2 * ry + 1) * (2 * ry + 1);
+    int64_t limit = ax * by;
+    int32_t half = rx;
+
+    for (int32_t dy = 0; dy <= ry; dy++)
+    {
+        int32_t next = half;
+        if (dy < ry)
+            while (next > 0 && 4 * (int64_t)next * next * by + 4 * (int64_t)(dy + 1) * (dy + 1) * ax > limit)
+                next--;
+        else
+            next = -1;
+
+        int32_t top = cy_top - dy;
+        int32_t bottom = cy_bottom + dy;
+        uint8_t both = top != bottom;
+
+        if (filled || dy == ry)
+        {
+            ssd1306_fill_oled_view_area(oled_user_buffer, cx_left - half, top, cx_right + half, top, fill);
+            if (both)
+                ssd1306_fill_oled_view_area(oled_user_buffer, cx_left - half, bottom, cx_right + half, bottom, fill);
+        }
+        else
+        {
+            int32_t inner = next + 1 < half ? next + 1 : half;
+            ssd1306_fill_oled_view_area(oled_user_buffer, cx_left - half, top, cx_left - inner, top, fill);
+            ssd1306_fill_oled_view_area(oled_user_buffer, cx_right + inner, top, cx_right + half, top, fill);
+            if (both)
+            {
+                ssd1306_fill_oled_view_area(oled_user_buffer, cx_left - half, bottom, cx_left - inner, bottom, fill);
+                ssd1306_fill_oled_view_area(oled_user_buffer, cx_right + inner, bottom, cx_right + half, bottom, fill);
+            }
+        }
+        half = next;
+    }
+
+    // straight sides between the top and bottom quarters.
+    if (cy_bottom - cy_top > 1)
+    {
+        if (filled)
+            ssd1306_fill_oled_view_area(oled_user_buffer, cx_left - rx, cy_top + 1, cx_right + rx, cy_bottom - 1, fill);
+        else
+        {
+            ssd1306_fill_oled_view_area(oled_user_buffer, cx_left - rx, cy_top + 1, cx_left - rx, cy_bottom - 1, fill);
+            ssd1306_fill_oled_view_area(oled_user_buffer, cx_right + rx, cy_top + 1, cx_right + rx, cy_bottom - 1, fill);
+        }
+    }
+}
+
+
+/*!
+    @brief  draw the outline of a circle.
+    @param  oled_user_buffer
+            oled_buffer pointer created by the viewbox function.
+    @param  xc
+            x coordinate of the circle center ( 0 based, as ssd1306_draw_oled_line ).
+    @param  yc
+            y coordinate of the circle center.
+    @param  r
+            radius of the circle.
+    @param  fill
+            '1' for fill with white and '0' for fill with black.
+    @return None (Void)
+    @note   the circle is clipped to the view.
+*/
+void ssd1306_draw_oled_circle(oled_buffer *oled_user_buffer, int32_t xc, int32_t yc, int32_t r, uint8_t fill)
+{
+    if (r < 0)
+        return;
+
+    ssd1306_begin_oled_draw(oled_user_buffer);
+    ssd1306_draw_oled_quarters(oled_user_buffer, xc, xc, yc, yc, r, r, 0, fill);
+    ssd1306_end_oled_draw(oled_user_buffer);
+}
+
+
+/*!
+    @brief  draw a filled circle.
+    @param  oled_user_buffer
+            oled_buffer pointer created by the viewbox function.
+    @param  xc
+            x coordinate of the circle center ( 0 based, as ssd1306_draw_oled_line ).
+    @param  yc
+            y coordinate of the circle center.
+    @param  r
+            radius of the circle.
+    @param  fill
+            '1' for fill with white and '0' for fill with black.
+    @return None (Void)
+    @note   the circle is clipped to the view.
+*/
+void ssd1306_fill_oled_circle(oled_buffer *oled_user_buffer, int32_t xc, int32_t yc, int32_t r, uint8_t fill)
+{
+    if (r < 0)
+        return;
+
+    ssd1306_begin_oled_draw(oled_user_buffer);
+    ssd1306_draw_oled_quarters(oled_user_buffer, xc, xc, yc, yc, r, r, 1, fill);
+    ssd1306_end_oled_draw(oled_user_buffer);
+}
+
+
+/*!
+    @brief  draw the outline of an ellipse.
+    @param  oled_user_buffer
+            oled_buffer pointer created by the viewbox function.
+    @param  xc
+            x coordinate of the ellipse center ( 0 based, as ssd1306_draw_oled_line ).
+    @param  yc
+            y coordinate of the ellipse center.
+    @param  rx
+            horizontal radius.
+    @param  ry
+            vertical radius.
+    @param  fill
+            '1' for fill with white and '0' for fill with black.
+    @return None (Void)
+    @note   the ellipse is clipped to the view.
+*/
+void ssd1306_draw_oled_ellipse(oled_buffer *oled_user_buffer, int32_t xc, int32_t yc, int32_t rx, int32_t ry, uint8_t fill)
+{
+    if (rx < 0 || ry < 0)
+        return;
+
+    ssd1306_begin_oled_draw(oled_user_buffer);
+    ssd1306_draw_oled_quarters(oled_user_buffer, xc, xc, yc, yc, rx, ry, 0, fill);
+    ssd1306_end_oled_draw(oled_user_buffer);
+}
+
+
+/*!
+    @brief  draw a filled ellipse.
+    @param  oled_user_buffer
+            oled_buffer pointer created by the viewbox function.
+    @param  xc
+            x coordinate of the ellipse center ( 0 based, as ssd1306_draw_oled_line ).
+    @param  yc
+            y coordinate of the ellipse center.
+    @param  rx
+            horizontal radius.
+    @param  ry
+            vertical radius.
+    @param  fill
+            '1' for fill with white and '0' for fill with black.
+    @return None (Void)
+    @note   the ellipse is clipped to the view.
+*/
+void ssd1306_fill_oled_ellipse(oled_buffer *oled_user_buffer, int32_t xc, int32_t yc, int32_t rx, int32_t ry, uint8_t fill)
+{
+    if (rx < 0 || ry < 0)
+        return;
+
+    ssd1306_begin_oled_draw(oled_user_buffer);
+    ssd1306_draw_oled_quarters(oled_user_buffer, xc, xc, yc, yc, rx, ry, 1, fill);
+    ssd1306_end_oled_draw(oled_user_buffer);
+}
+
+
+/*!
+    @brief  clamp the corner radius of a rounded rectangle and draw it.
+    @param  oled_user_buffer
+            oled_buffer pointer created by the viewbox function.
+    @param  x
+            left column of the rectangle.
+    @param  y
+            top row of the rectangle.
+    @param  width
+            width of the rectangle.
+    @param  height
+            height of the rectangle.
+    @param  r
+            corner radius, limited to half the shorter side.
+    @param  filled
+            1 to fill the rectangle, 0 for its outline.
+    @param  fill
+            '1' for fill with white and '0' for fill with black.
+    @return None (Void)
+*/
+static void ssd1306_draw_oled_round_area(oled_buffer *oled_user_buffer, int32_t x, int32_t y, int32_t width, int32_t height, int32_t r, uint8_t filled, uint8_t fill)
+{
+    if (width <= 0 || height <= 0)
+        return;
+
+    if (r > (width - 1) / 2) r = (width - 1) / 2;
+    if (r > (height - 1) / 2) r = (height - 1) / 2;
+    if (r < 0) r = 0;
+
+    ssd1306_begin_oled_draw(oled_user_buffer);
+    ssd1306_draw_oled_quarters(oled_user_buffer, x + r, x + width - 1 - r, y + r, y + height - 1 - r, r, r, filled, fill);
+    ssd1306_end_oled_draw(oled_user_buffer);
+}
+
+
+/*!
+    @brief  draw the outline of a rectangle with rounded corners.
+    @param  oled_user_buffer
+            oled_buffer pointer created by the viewbox function.
+    @param  x
+            left column of the rectangle ( 0 based, as ssd1306_draw_oled_line ).
+    @param  y
+            top row of the rectangle.
+    @param  width
+            width of the rectangle.
+    @param  height
+            height of the rectangle.
+    @param  r
+            corner radius, limited to half the shorter side.
+    @param  fill
+            '1' for fill with white and '0' for fill with black.
+    @return None (Void)
+    @note   the rectangle is clipped to the view.
+*/
+void ssd1306_draw_oled_round_rect(oled_buffer *oled_user_buffer, int32_t x, int32_t y, int32_t width, int32_t height, int32_t r, uint8_t fill)
+{
+    ssd1306_draw_oled_round_area(oled_user_buffer, x, y, width, height, r, 0, fill);
+}
+
+
+/*!
+    @brief  draw a filled rectangle with rounded corners.
+    @param  oled_user_buffer
+            oled_buffer pointer created by the viewbox function.
+    @param  x
+            left column of the rectangle ( 0 based, as ssd1306_draw_oled_line ).
+    @param  y
+            top row of the rectangle.
+    @param  width
+            width of the rectangle.
+    @param  height
+            height of the rectangle.
+    @param  r
+            corner radius, limited to half the shorter side.
+    @param  fill
+            '1' for fill with white and '0' for fill with black.
+    @return None (Void)
+    @note   the rectangle is clipped to the view.
+*/
+void ssd1306_fill_oled_round_rect(oled_buffer *oled_user_buffer, int32_t x, int32_t y, int32_t width, int32_t height, int32_t r, uint8_t fill)
+{
+    ssd1306_draw_oled_round_area(oled_user_buffer, x, y, width, height, r, 1, fill);
+}
+
+
+/*!
+    @brief  draw line.
+    @param  oled_user_buffer
+            oled_buffer pointer created by the viewbox function.
+    @param  x0
+            start x coordinate of the line.
+    @param  y0
+            start y coordinate of the line.
+    @param  x1
+            end x coordinate of the line.
+    @param  y1
+            end y coordinate of the line.
+    @param  fill
+            '1' for fill with white and '0' for fill with black.
+    @return None (Void)
+    @note   the line is clipped to the view. horizontal and vertical lines are drawn as one span
+            ( a byte mask across a page row, or whole bytes down a column ), others pixel by pixel.
+*/
+void ssd1306_draw_oled_line(oled_buffer *oled_user_buffer, int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint8_t fill)
+{
+    ssd1306_begin_oled_draw(oled_user_buffer);
+    if (x0 == x1 || y0 == y1)
+    {
+        ssd1306_fill_oled_view_area(oled_user_buffer, x0 < x1 ? x0 : x1, y0 < y1 ? y0 : y1, x0 < x1 ? x1 : x0, y0 < y1 ? y1 : y0, fill);
+        ssd1306_end_oled_draw(oled_user_buffer);
+        return;
+    }
+
+    ssd1306_mark_oled_view_dirty(oled_user_buffer, x0 < x1 ? x0 : x1, x0 < x1 ? x1 : x0, (y0 < y1 ? y0 : y1) / 8, (y0 < y1 ? y1 : y0) / 8);
+
+    int dx = abs(x1 - x0);
+    int sx = x0 < x1 ? 1 : -1;
+    int dy = -abs(y1 - y0);
+    int sy = y0 < y1 ? 1 : -1;
+    int err = dx + dy;
+
+    while (1)
+    {
+        // Set the pixel at (x0, y0)
+        if (x0 >= 0 && x0 < oled_user_buffer->width && y0 >= 0 && y0 < (oled_user_buffer->page * 8))
+        {
+            uint16_t index = x0 + (y0 / 8) * (oled_user_buffer->width);
+            if (fill)
+                oled_user_buffer->oled_user_buffer[index + 1] |= (1 << (y0 % 8));
+            else
+                oled_user_buffer->oled_user_buffer[index + 1] &= ~(1 << (y0 % 8));
+        }
+
+        if (x0 == x1 && y0 == y1)
+            break;
+
+        int e2 = 2 * err;
+        if (e2 >= dy)
+        {
+            err += dy;
+            x0 += sx;
+        }
+        if (e2 <= dx)
+        {
+            err += dx;
+            y0 += sy;
+        }
+    }
+    ssd1306_end_oled_draw(oled_user_buffer);
+}
+
+
+/*!
+    @brief  stop the scrolling in the ssd1306.
+    @return None (Void)
+    @note   this stop scrolling which is done by the ssd1306 itself, the hardware scrolled view
+            is written back from its origin.
+*/
+void ssd1306_scroll_oled_stop(void)
+{
+    xSemaphoreTake(oled_flush_lock, portMAX_DELAY);
+    ssd1306_send_oled_command(OLED_STOP_SCROLLING);
+
+    if (oled_hw_scroll_view)
+    {
+        // the controller leaves its pages shifted, write the view back as it is.
+        oled_buffer *view = oled_hw_scroll_view;
+        ssd1306_release_oled_hw_scroll(view);
+        ssd1306_flush_oled_view(view);
+    }
+    xSemaphoreGive(oled_flush_lock);
+}
+
+
+
+/*!
+    @brief  this init your font array so that you can use it with this library.
+    @param  font_array
+            pointer of  font array.
+    @param  width
+            width of the font.
+    @param  height
+           height of the font, a font taller than 8 spans ( height + 7 ) / 8 pages.
+    @param  offset
+            it is use to manage the conversion of the ASCI value and its font position in array.
+    @return font_pack struct.
+    @note   currently this library don't support custom font. so use the 5x8 font provided with this library.
+            a glyph of a tall font is stored page by page, its top page row of width bytes first.
+*/
+font_pack *ssd1306_init_oled_font(const uint8_t *font_array, uint8_t width, uint8_t height, uint8_t offset)
 {
     if (width < 1)
         return NULL;
@@ -522,6 +1763,14 @@ font_pack *ssd1306_init_oled_font(const uint8_t *font_array, uint8_t width, uint
     font_pack_array->width = width;
     font_pack_array->height = height;
     font_pack_array->offset = offset;
+    font_pack_array->glyphs = NULL;
+    font_pack_array->glyph_count = 0;
+    font_pack_array->kerning = NULL;
+    font_pack_array->kerning_count = 0;
+    font_pack_array->ranges = NULL;
+    font_pack_array->range_count = 0;
+    font_pack_array->cached = 0;
+    memset(font_pack_array->shift_cache, 0, sizeof(font_pack_array->shift_cache));
 
     return font_pack_array;
 }
@@ -535,10 +1784,447 @@ font_pack *ssd1306_init_oled_font(const uint8_t *font_array, uint8_t width, uint
 */
 void ssd1306_delete_oled_font(font_pack *font_pack)
 {
+    for (int bits = 0; bits < 8; bits++)
+        free(font_pack->shift_cache[bits]);
     free(font_pack);
 }
 
 
+/*!
+    @brief  give the font per glyph widths, advances and offsets ( proportional font ).
+    @param  font_pack
+            font_pack created by ssd1306_init_oled_font, its font_array holds the glyph columns back to back.
+    @param  glyphs
+            one entry per glyph, glyph n is the character offset + n.
+    @param  glyph_count
+            number of entries in glyphs.
+    @return None (Void)
+    @note   the tables are only referenced, keep them in flash ( const ). the width given to
+            ssd1306_init_oled_font is then only used as the widest glyph.
+*/
+void ssd1306_set_oled_font_glyphs(font_pack *font_pack, const font_glyph *glyphs, uint16_t glyph_count)
+{
+    font_pack->glyphs = glyphs;
+    font_pack->glyph_count = glyph_count;
+}
+
+
+/*!
+    @brief  give the font kerning pairs.
+    @param  font_pack
+            font_pack struct pointer.
+    @param  kerning
+            pairs sorted by left glyph then right glyph.
+    @param  kerning_count
+            number of pairs.
+    @return None (Void)
+    @note   the adjust of a pair is added to the advance of its left glyph when the right one follows it.
+*/
+void ssd1306_set_oled_font_kerning(font_pack *font_pack, const font_kerning *kerning, uint16_t kerning_count)
+{
+    font_pack->kerning = kerning;
+    font_pack->kerning_count = kerning_count;
+}
+
+
+/*!
+    @brief  give the font a sparse code point index.
+    @param  font_pack
+            font_pack struct pointer.
+    @param  ranges
+            runs of code points sorted by their first code point, they must not overlap.
+    @param  range_count
+            number of runs.
+    @return None (Void)
+    @note   with an index the offset of the font is ignored, a code point outside every run has no glyph
+            and is skipped by the draw functions. the table is only referenced, keep it in flash ( const ).
+*/
+void ssd1306_set_oled_font_ranges(font_pack *font_pack, const font_range *ranges, uint16_t range_count)
+{
+    font_pack->ranges = ranges;
+    font_pack->range_count = range_count;
+}
+
+
+/*!
+    @brief  build the pre-shifted columns of every glyph of the font for one y bit offset.
+    @param  font_pack
+            font_pack struct pointer, with its glyph_count set.
+    @param  bits
+            y bit offset ( 1 - 7 ).
+    @return the table, NULL when out of memory.
+    @note   the table mirrors the font array with every byte split in two, so the glyph at
+            bitmap_offset has its entry at 2 * bitmap_offset.
+*/
+static uint8_t *ssd1306_build_oled_shift_table(const font_pack *font_pack, uint8_t bits)
+{
+    // size of the font array, the end of its furthest glyph.
+    uint32_t size = 0;
+    for (uint32_t g = 0; g < font_pack->glyph_count; g++)
+    {
+        font_glyph glyph;
+        ssd1306_get_oled_glyph(font_pack, g, &glyph);
+        if (glyph.bitmap_offset + glyph.width > size)
+            size = glyph.bitmap_offset + glyph.width;
+    }
+
+    uint8_t *table = malloc(size * 2);
+    if (!table)
+        return NULL;
+
+    for (uint32_t g = 0; g < font_pack->glyph_count; g++)
+    {
+        font_glyph glyph;
+        ssd1306_get_oled_glyph(font_pack, g, &glyph);
+        const uint8_t *columns = font_pack->font_array + glyph.bitmap_offset;
+        uint8_t *entry = &table[glyph.bitmap_offset * 2];
+        for (int i = 0; i < glyph.width; i++)
+        {
+            entry[i] = columns[i] << bits;
+            entry[glyph.width + i] = columns[i] >> (8 - bits);
+        }
+    }
+    return table;
+}
+
+
+/*!
+    @brief  let the font keep its glyphs pre-shifted for drawing at any y offset.
+    @param  font_pack
+            font_pack struct pointer.
+    @param  glyph_count
+            number of glyphs in the font array ( e.g. sizeof(font_5x7) / 5 ), ignored when the font has a glyph table.
+    @return None (Void)
+    @note   a table is built for every y bit offset ( 1 - 7 ) right away, each takes twice the size of
+            the font array, drawing then ORs two straight runs into the view. glyphs drawn on a page
+            boundary ( y_offset % 8 == 0 ) never need a table. the tables are only read afterwards, so
+            tasks can draw with the font at the same time. set the glyph table of a proportional font first.
+*/
+void ssd1306_cache_oled_font(font_pack *font_pack, uint16_t glyph_count)
+{
+    if (font_pack->height > 8)
+    {
+        ESP_LOGW(TAG, "Only fonts of one page height can be cached.");
+        return;
+    }
+    if (!font_pack->glyphs)
+        font_pack->glyph_count = glyph_count;
+    if (!font_pack->glyph_count)
+    {
+        ESP_LOGW(TAG, "The glyph count is needed to cache a font.");
+        return;
+    }
+
+    font_pack->cached = 0;
+    for (uint8_t bits = 1; bits < 8; bits++)
+    {
+        free(font_pack->shift_cache[bits]);
+        font_pack->shift_cache[bits] = ssd1306_build_oled_shift_table(font_pack, bits);
+        if (!font_pack->shift_cache[bits])
+        {
+            ESP_LOGE(TAG, "Memory allocation failed for the glyph cache, drawing without it.");
+            return;
+        }
+    }
+    font_pack->cached = 1;
+}
+
+
+/*!
+    @brief  number of pages a glyph of the font spans.
+    @param  font_pack
+            font_pack struct pointer.
+    @return ( height + 7 ) / 8, at least 1.
+*/
+static int ssd1306_oled_font_pages(const font_pack *font_pack)
+{
+    return font_pack->height > 8 ? (font_pack->height + 7) / 8 : 1;
+}
+
+
+/*!
+    @brief  metrics of a glyph.
+    @param  font_pack
+            font_pack struct pointer.
+    @param  glyph
+            index of the glyph in the font.
+    @param  metrics
+            filled with the glyph metrics, a fixed width font gives width + 1 as advance.
+    @return 1 if the glyph exists, 0 otherwise.
+*/
+static uint8_t ssd1306_get_oled_glyph(const font_pack *font_pack, uint32_t glyph, font_glyph *metrics)
+{
+    if (font_pack->glyphs)
+    {
+        if (glyph >= font_pack->glyph_count)
+            return 0;
+        *metrics = font_pack->glyphs[glyph];
+        return 1;
+    }
+
+    if (font_pack->glyph_count && glyph >= font_pack->glyph_count)
+        return 0;
+    metrics->bitmap_offset = glyph * font_pack->width * ssd1306_oled_font_pages(font_pack);
+    metrics->width = font_pack->width;
+    metrics->advance = font_pack->width + 1;
+    metrics->x_offset = 0;
+    return 1;
+}
+
+
+/*!
+    @brief  kerning adjust between two glyphs.
+    @param  font_pack
+            font_pack struct pointer.
+    @param  left
+            glyph before.
+    @param  right
+            glyph after.
+    @return columns to add to the advance of the left glyph.
+    @note   binary search over the sorted pairs.
+*/
+static int8_t ssd1306_get_oled_kerning(const font_pack *font_pack, uint16_t left, uint16_t right)
+{
+    uint32_t key = ((uint32_t)left << 16) | right;
+    int32_t low = 0;
+    int32_t high = (int32_t)font_pack->kerning_count - 1;
+
+    while (low <= high)
+    {
+        int32_t mid = (low + high) / 2;
+        const font_kerning *pair = &font_pack->kerning[mid];
+        uint32_t pair_key = ((uint32_t)pair->left << 16) | pair->right;
+
+        if (pair_key == key)
+            return pair->adjust;
+        if (pair_key < key)
+            low = mid + 1;
+        else
+            high = mid - 1;
+    }
+    return 0;
+}
+
+
+/*!
+    @brief  glyph of a code point.
+    @param  font_pack
+            font_pack struct pointer.
+    @param  code_point
+            unicode code point.
+    @return index of the glyph in the font, UINT32_MAX when the font has none.
+    @note   binary search over the code point runs, or code_point - offset without them. a font
+            without runs only covers Latin-1, up to its glyph_count when that is known.
+*/
+static uint32_t ssd1306_find_oled_glyph(const font_pack *font_pack, uint32_t code_point)
+{
+    if (!font_pack->ranges)
+    {
+        if (code_point < font_pack->offset || code_point > 0xFF)
+            return UINT32_MAX;
+        if (font_pack->glyph_count && code_point - font_pack->offset >= font_pack->glyph_count)
+            return UINT32_MAX;
+        return code_point - font_pack->offset;
+    }
+
+    int32_t low = 0;
+    int32_t high = (int32_t)font_pack->range_count - 1;
+
+    while (low <= high)
+    {
+        int32_t mid = (low + high) / 2;
+        const font_range *range = &font_pack->ranges[mid];
+
+        if (code_point < range->first)
+            high = mid - 1;
+        else if (code_point - range->first >= range->count)
+            low = mid + 1;
+        else
+            return range->glyph + (code_point - range->first);
+    }
+    return UINT32_MAX;
+}
+
+
+/*!
+    @brief  decode the next character of a UTF-8 string.
+    @param  string
+            pointer to the string position, moved past the character.
+    @return code point of the character, U+FFFD for a malformed sequence ( one byte is skipped ).
+*/
+static uint32_t ssd1306_decode_oled_utf8(const char **string)
+{
+    const uint8_t *s = (const uint8_t *)*string;
+    uint32_t code_point;
+    int length;
+
+    if (s[0] < 0x80)
+    {
+        *string += 1;
+        return s[0];
+    }
+    else if ((s[0] & 0xE0) == 0xC0)
+    {
+        code_point = s[0] & 0x1F;
+        length = 2;
+    }
+    else if ((s[0] & 0xF0) == 0xE0)
+    {
+        code_point = s[0] & 0x0F;
+        length = 3;
+    }
+    else if ((s[0] & 0xF8) == 0xF0)
+    {
+        code_point = s[0] & 0x07;
+        length = 4;
+    }
+    else
+    {
+        *string += 1;
+        return 0xFFFD;
+    }
+
+    // a missing continuation byte ( e.g. the terminating 0 ) ends the sequence early.
+    for (int i = 1; i < length; i++)
+    {
+        if ((s[i] & 0xC0) != 0x80)
+        {
+            *string += 1;
+            return 0xFFFD;
+        }
+        code_point = (code_point << 6) | (s[i] & 0x3F);
+    }
+
+    // overlong forms, surrogates and values past U+10FFFF.
+    static const uint32_t minimum[5] = {0, 0, 0x80, 0x800, 0x10000};
+    if (code_point < minimum[length] || code_point > 0x10FFFF || (code_point >= 0xD800 && code_point <= 0xDFFF))
+    {
+        *string += 1;
+        return 0xFFFD;
+    }
+
+    *string += length;
+    return code_point;
+}
+
+
+/*!
+    @brief  pre-shifted columns of a glyph.
+    @param  font_pack
+            font_pack struct pointer.
+    @param  metrics
+            metrics of the glyph.
+    @param  bits
+            y bit offset ( 1 - 7 ).
+    @return width upper page bytes followed by width lower page bytes, NULL when the font isn't cached.
+*/
+static const uint8_t *ssd1306_get_oled_shifted_glyph(const font_pack *font_pack, const font_glyph *metrics, uint8_t bits)
+{
+    if (!font_pack->cached)
+        return NULL;
+    return &font_pack->shift_cache[bits][metrics->bitmap_offset * 2];
+}
+
+
+/*!
+    @brief  draw one glyph of the font.
+    @param  oled_user_buffer
+            oled_buffer type pointer
+    @param  cursor
+            position of cursor along x axis.
+    @param  glyph
+            index of the glyph in the font.
+    @param  font_pack
+            font_pack struct pointer.
+    @param  y_offset
+            distance from the top of your buffer, negative when the glyph starts above it.
+    @param  clip_start
+            first column of the view the glyph may touch ( at least 0 ).
+    @param  clip_end
+            last column of the view the glyph may touch ( at most width - 1 ).
+    @return advance of the glyph, 0 when the font has no such glyph.
+    @note   only the rows of the glyph inside the view are drawn.
+*/
+static int ssd1306_draw_oled_glyph(oled_buffer *oled_user_buffer, int cursor, uint32_t glyph, font_pack *font_pack, int y_offset, int clip_start, int clip_end)
+{
+    font_glyph metrics;
+    if (!ssd1306_get_oled_glyph(font_pack, glyph, &metrics))
+        return 0;
+
+    const uint8_t *char_bitmap = font_pack->font_array + metrics.bitmap_offset;
+    int x = cursor + metrics.x_offset;
+    int page = y_offset >= 0 ? y_offset / 8 : -((7 - y_offset) / 8);     // rounded down, a glyph may start above the view.
+    uint8_t bits = y_offset - (page * 8);
+    int page_width = oled_user_buffer->width;
+    int view_pages = oled_user_buffer->page;
+    int glyph_pages = ssd1306_oled_font_pages(font_pack);
+    uint8_t *columns = &oled_user_buffer->oled_user_buffer[x + 1];
+
+    // columns of the glyph inside the clip, and the view pages it touches.
+    int first = clip_start > x ? clip_start - x : 0;
+    int last = clip_end < x + metrics.width - 1 ? clip_end - x : metrics.width - 1;
+    int page_end = page + glyph_pages - (bits == 0 ? 1 : 0);
+    if (page_end > view_pages - 1)
+        page_end = view_pages - 1;
+    if (first > last || page >= view_pages || page_end < 0)
+        return metrics.advance;
+
+    if (bits == 0)
+    {
+        // glyph sits on a page boundary, every page row of it lands on one view page.
+        for (int p = page < 0 ? -page : 0; p < glyph_pages && page + p < view_pages; p++)
+        {
+            const uint8_t *row = char_bitmap + (p * metrics.width);
+            uint8_t *dst = columns + ((page + p) * page_width);
+            for (int i = first; i <= last; i++)
+                dst[i] |= row[i];
+        }
+        ssd1306_mark_oled_view_dirty(oled_user_buffer, x + first, x + last, page, page_end);
+        return metrics.advance;
+    }
+
+    const uint8_t *shifted = glyph_pages == 1 ? ssd1306_get_oled_shifted_glyph(font_pack, &metrics, bits) : NULL;
+    if (shifted)
+    {
+        if (page >= 0)
+        {
+            uint8_t *upper = columns + (page * page_width);
+            for (int i = first; i <= last; i++)
+                upper[i] |= shifted[i];
+        }
+        if (page + 1 < view_pages)
+        {
+            uint8_t *lower = columns + ((page + 1) * page_width);
+            for (int i = first; i <= last; i++)
+                lower[i] |= shifted[metrics.width + i];
+        }
+    }
+    else
+    {
+        // every page row splits its bits between the view page it starts on and the next one,
+        // rows above the view only keep their lower part.
+        for (int p = page < -1 ? -1 - page : 0; p < glyph_pages && page + p < view_pages; p++)
+        {
+            const uint8_t *row = char_bitmap + (p * metrics.width);
+            if (page + p >= 0)
+            {
+                uint8_t *upper = columns + ((page + p) * page_width);
+                for (int i = first; i <= last; i++)
+                    upper[i] |= row[i] << bits;
+            }
+            if (page + p + 1 < view_pages)
+            {
+                uint8_t *lower = columns + ((page + p + 1) * page_width);
+                for (int i = first; i <= last; i++)
+                    lower[i] |= row[i] >> (8 - bits);
+            }
+        }
+    }
+
+    ssd1306_mark_oled_view_dirty(oled_user_buffer, x + first, x + last, page, page_end);
+    return metrics.advance;
+}
+
 
 /*!
     @brief  put a character on the screen from the font_pack
@@ -552,29 +2238,102 @@ void ssd1306_delete_oled_font(font_pack *font_pack)
             distance fromthe top of your buffer.
     @return None (void)
     @note   you the char you passed is not displaying from the font, try to change the font_pack offset value.
+            a glyph on a page boundary only touches one page, other offsets use the pre-shifted
+            columns of a cached font ( see ssd1306_cache_oled_font ). the glyph is clipped at the view edges.
 */
 void ssd1306_draw_oled_char(oled_buffer *oled_user_buffer, int cursor, char c, font_pack *font_pack, int y_offset)
 {
+    ssd1306_begin_oled_draw(oled_user_buffer);
+    uint32_t glyph = ssd1306_find_oled_glyph(font_pack, (uint8_t)c);
+    if (glyph != UINT32_MAX)
+        ssd1306_draw_oled_glyph(oled_user_buffer, cursor, glyph, font_pack, y_offset, 0, oled_user_buffer->width - 1);
+    oled_user_buffer->cursor = cursor;
+    ssd1306_end_oled_draw(oled_user_buffer);
+}
+
 
-    const uint8_t *char_bitmap = font_pack->font_array + (c - font_pack->offset) * font_pack->width;
+/*!
+    @brief  width of a string drawn with the font.
+    @param  font_pack
+            font_pack struct pointer.
+    @param  string
+            UTF-8 string.
+    @param  length
+            bytes of the string to measure, strlen( string ) for all of it.
+    @return columns from the cursor to the last lit column of the last glyph, 0 for an empty string.
+    @note   the spacing after the last glyph isn't counted, so the result is what alignment needs.
+*/
+uint16_t ssd1306_measure_oled_string(const font_pack *font_pack, const char *string, size_t length)
+{
+    const char *end = string + length;
+    uint32_t previous = UINT32_MAX;
+    int cursor = 0;
+    int extent = 0;
 
-    for (int i = 0; i < font_pack->width; i++)
+    while (string < end && *string)
     {
-        uint8_t font_col = char_bitmap[i];
+        uint32_t glyph = ssd1306_find_oled_glyph(font_pack, ssd1306_decode_oled_utf8(&string));
+        font_glyph metrics;
+        if (glyph == UINT32_MAX || !ssd1306_get_oled_glyph(font_pack, glyph, &metrics))
+            continue;
+        if (previous != UINT32_MAX && font_pack->kerning_count)
+            cursor += ssd1306_get_oled_kerning(font_pack, previous, glyph);
+
+        if (metrics.width && cursor + metrics.x_offset + metrics.width > extent)
+            extent = cursor + metrics.x_offset + metrics.width;
+        cursor += metrics.advance;
+        previous = glyph;
+    }
+    return extent;
+}
 
-        // Split bits between two pages
-        uint8_t upper = font_col << y_offset % 8;
-        uint8_t lower = font_col >> (8 - y_offset % 8);
 
-        int page_width = oled_user_buffer->width;
-        int page_start = y_offset / 8 * page_width;
-        int next_page_start = (y_offset / 8 + 1) * page_width;
+/*!
+    @brief  put part of a string on the screen, clipped to a column range of the view.
+    @param  oled_user_buffer
+            oled_buffer type pointer
+    @param  cursor
+            position of cursor along x axis, may be left of the clip.
+    @param  string
+            UTF-8 string.
+    @param  length
+            bytes of the string to draw, strlen( string ) for all of it.
+    @param  font_pack
+            font_pack struct pointer.
+    @param  y_offset
+            distance fromthe top of your buffer.
+    @param  clip_start
+            first column that may be drawn.
+    @param  clip_end
+            last column that may be drawn.
+    @return None (void)
+    @note   the clip is limited to the view, glyphs are cut at the column, not dropped. rows above
+            ( negative y_offset ) or below the view are cut the same way.
+*/
+void ssd1306_draw_oled_text(oled_buffer *oled_user_buffer, int cursor, const char *string, size_t length, font_pack *font_pack, int y_offset, int clip_start, int clip_end)
+{
+    const char *end = string + length;
+    uint32_t previous = UINT32_MAX;
+
+    if (clip_start < 0) clip_start = 0;
+    if (clip_end > oled_user_buffer->width - 1) clip_end = oled_user_buffer->width - 1;
 
-        oled_user_buffer->oled_user_buffer[page_start + cursor + i + 1] |= upper;
-        oled_user_buffer->oled_user_buffer[next_page_start + cursor + i + 1] |= lower;
+    ssd1306_begin_oled_draw(oled_user_buffer);    // the whole string reaches the screen at once.
+    while (string < end && *string)
+    {
+        uint32_t glyph = ssd1306_find_oled_glyph(font_pack, ssd1306_decode_oled_utf8(&string));
+        if (glyph == UINT32_MAX)
+            continue;
+        if (previous != UINT32_MAX && font_pack->kerning_count)
+            cursor += ssd1306_get_oled_kerning(font_pack, previous, glyph);
+
+        oled_user_buffer->cursor = cursor;
+        if (cursor > clip_end)
+            break;
+        cursor += ssd1306_draw_oled_glyph(oled_user_buffer, cursor, glyph, font_pack, y_offset, clip_start, clip_end);
+        previous = glyph;
     }
-
-    oled_user_buffer->cursor = cursor;
+    ssd1306_end_oled_draw(oled_user_buffer);
 }
 
 
@@ -585,20 +2344,18 @@ void ssd1306_draw_oled_char(oled_buffer *oled_user_buffer, int cursor, char c, f
     @param  cursor
             position of cursor along x axis.
     @param  string
-            string value or the pointe of string value.
+            UTF-8 string value or the pointe of string value.
     @param  y_offset
             distance fromthe top of your buffer.
     @return None (void)
     @note   if the char you passed is not displaying from the font, try to change the font_pack offset value.
+            the cursor moves by the advance of every glyph ( width + 1 for a fixed width font ) and the kerning of the pair.
+            characters the font has no glyph for are skipped ( see ssd1306_set_oled_font_ranges ).
+            the string is clipped at the view edges, see ssd1306_text.h for wrapping and alignment.
 */
 void ssd1306_draw_oled_string(oled_buffer *oled_user_buffer, int cursor, const char *string, font_pack *font_pack, int y_offset)
 {
-    while (*string)
-    {
-        ssd1306_draw_oled_char(oled_user_buffer, cursor, *string, font_pack, y_offset);
-        cursor += 6; // 5 pixels font + 1 spacing
-        string++;
-    }
+    ssd1306_draw_oled_text(oled_user_buffer, cursor, string, strlen(string), font_pack, y_offset, 0, oled_user_buffer->width - 1);
 }
 
 /*!
@@ -614,93 +2371,465 @@ void ssd1306_draw_oled_string(oled_buffer *oled_user_buffer, int cursor, const c
 */
 void ssd1306_inset_oled_bitmap(oled_buffer *oled_user_buffer,const uint8_t *bitmap, int16_t size)
 {
-    memcpy(&oled_user_buffer->oled_user_buffer[1], bitmap, size>oled_user_buffer->oled_user_buffer_size?oled_user_buffer->oled_user_buffer_size:size);    
+    if (size <= 0)
+        return;
+
+    ssd1306_begin_oled_draw(oled_user_buffer);
+    // the buffer size counts the control byte in front of the pixels.
+    if ((uint32_t)size > oled_user_buffer->oled_user_buffer_size - 1)
+        size = oled_user_buffer->oled_user_buffer_size - 1;
+    memcpy(&oled_user_buffer->oled_user_buffer[1], bitmap, size);
+    ssd1306_mark_oled_view_dirty(oled_user_buffer, 0, oled_user_buffer->width - 1, 0, (size - 1) / oled_user_buffer->width);
+    ssd1306_end_oled_draw(oled_user_buffer);
 }
 
 
 /*!
-    @brief  shift the oled buffer.
+    @brief  decode a packed bitmap into the view.
     @param  oled_user_buffer
             oled_buffer type pointer
-    @param  direction
-            you may choose from enum values, HORIZONTAL_LEFT, HORIZONTAL_RIGHT, VERTICAL_DOWN, VERTICAL_UP
-    @param  steps
-            number of step with you want to shift your buffer.
+    @param  col
+            column of the view the bitmap lands on ( 0 based, may be outside the view ).
+    @param  page
+            page of the view the bitmap lands on ( 0 based, may be outside the view ).
+    @param  packed
+            bitmap packed with ssd1306_pack_oled_bitmap ( see ssd1306_bitmap_codec.h ).
+    @param  size
+            bytes of the packed bitmap.
+    @return ESP_OK or ESP_ERR_INVALID_ARG if the packed data is malformed.
+    @note   the bitmap replaces the view content under it, clipped to the view. it is decoded straight into
+            the view, only a window of OLED_PACKED_WINDOW bytes is kept on the stack for the back references.
+*/
+esp_err_t ssd1306_inset_oled_packed_bitmap(oled_buffer *oled_user_buffer, int32_t col, int32_t page, const uint8_t *packed, size_t size)
+{
+    uint16_t width;
+    uint8_t pages;
+    if (ssd1306_read_packed_oled_header(packed, size, &width, &pages) != 0)
+        return ESP_ERR_INVALID_ARG;
+
+    ssd1306_begin_oled_draw(oled_user_buffer);
+    int result = ssd1306_unpack_oled_bitmap(packed, size, &oled_user_buffer->oled_user_buffer[1],
+                                            oled_user_buffer->width, oled_user_buffer->page, col, page);
+    ssd1306_mark_oled_view_dirty(oled_user_buffer, col, col + width - 1, page, page + pages - 1);
+    ssd1306_end_oled_draw(oled_user_buffer);
+
+    if (result != 0)
+    {
+        ESP_LOGE(TAG, "Malformed packed bitmap.");
+        return ESP_ERR_INVALID_ARG;
+    }
+    return ESP_OK;
+}
+
+
+/*!
+    @brief  place part of a bitmap anywhere in the view.
+    @param  oled_user_buffer
+            oled_buffer type pointer
+    @param  x
+            column of the view the area lands on ( 0 based, may be outside the view ).
+    @param  y
+            row of the view the area lands on ( 0 based, may be outside the view ).
+    @param  bitmap
+            page-major bitmap ( vertical 1 byte mode ), bitmap_width bytes per page row.
+    @param  bitmap_width
+            width of the whole bitmap.
+    @param  src_x
+            left column of the area in the bitmap.
+    @param  src_y
+            top row of the area in the bitmap.
+    @param  width
+            width of the area.
+    @param  height
+            height of the area.
+    @param  op
+            BLIT_COPY, BLIT_OR, BLIT_AND, BLIT_XOR or BLIT_AND_NOT.
     @return None (void)
-    @note   it shift oled buffer by 1 bit therefore 1 step = 1 bit shift.
+    @note   the area is clipped to the view and only its pixels change. every view page is built from
+            two bitmap page rows shifted into place, then merged under the mask of the rows it covers.
+            the bitmap pages past the area are never read.
 */
-void ssd1306_shift_oled_buffer(oled_buffer *oled_user_buffer, scroll_type direction, uint32_t steps)
+void ssd1306_blit_oled_area(oled_buffer *oled_user_buffer, int32_t x, int32_t y, const uint8_t *bitmap, uint16_t bitmap_width, int32_t src_x, int32_t src_y, int32_t width, int32_t height, blit_op op)
 {
-    if (direction == HORIZONTAL_LEFT)
+    // clipping the area to the view.
+    int32_t col_start = x > 0 ? x : 0;
+    int32_t col_end = x + width < oled_user_buffer->width ? x + width : oled_user_buffer->width;
+    int32_t row_start = y > 0 ? y : 0;
+    int32_t row_end = y + height < oled_user_buffer->page * 8 ? y + height : oled_user_buffer->page * 8;
+    if (col_start >= col_end || row_start >= row_end || src_x < 0 || src_y < 0)
+        return;
+
+    int32_t span = col_end - col_start;
+    int32_t src_rows = src_y + height;
+    int32_t page_start = row_start / 8;
+    int32_t page_end = (row_end - 1) / 8;
+
+    ssd1306_begin_oled_draw(oled_user_buffer);
+    for (int32_t page = page_start; page <= page_end; page++)
     {
-        for (int page = 0; page < steps; page++)
+        uint8_t mask = 0xFF;
+        if (page == page_start) mask &= 0xFF << (row_start % 8);
+        if (page == page_end) mask &= 0xFF >> (7 - ((row_end - 1) % 8));
+
+        // bitmap row landing on the top of this view page, split in its page and bit.
+        int32_t row = (page * 8) - y + src_y;
+        int32_t src_page = row >= 0 ? row / 8 : -1;
+        uint8_t bits = row - (src_page * 8);
+        const uint8_t *lo = src_page >= 0 ? &bitmap[(src_page * bitmap_width) + src_x + (col_start - x)] : NULL;
+        const uint8_t *hi = bits && (src_page + 1) * 8 < src_rows ? &bitmap[((src_page + 1) * bitmap_width) + src_x + (col_start - x)] : NULL;
+        uint8_t *dst = &oled_user_buffer->oled_user_buffer[(page * oled_user_buffer->width) + col_start + 1];
+
+        for (int32_t i = 0; i < span; i++)
         {
-            uint8_t *page_start = oled_user_buffer->oled_user_buffer + (page * oled_user_buffer->width);
-            uint8_t temp = page_start[1]; // store first byte
-            for (int col = 0; col < oled_user_buffer->width; col++)
+            uint8_t src = 0;
+            if (lo) src = lo[i] >> bits;
+            if (hi) src |= hi[i] << (8 - bits);
+
+            uint8_t out;
+            switch (op)
             {
-                page_start[col + 1] = page_start[col + 2];
+            case BLIT_OR:      out = dst[i] | src; break;
+            case BLIT_AND:     out = dst[i] & src; break;
+            case BLIT_XOR:     out = dst[i] ^ src; break;
+            case BLIT_AND_NOT: out = dst[i] & ~src; break;
+            default:           out = src; break;
             }
-
-            // Wrap the first data byte to the end
-            page_start[oled_user_buffer->width] = temp;
+            dst[i] = (dst[i] & ~mask) | (out & mask);
         }
-        ssd1306_send_oled_display_buffer(oled_user_buffer);
     }
-    if (direction == HORIZONTAL_RIGHT)
+    ssd1306_mark_oled_view_dirty(oled_user_buffer, col_start, col_end - 1, page_start, page_end);
+    ssd1306_end_oled_draw(oled_user_buffer);
+}
+
+
+/*!
+    @brief  place a bitmap anywhere in the view.
+    @param  oled_user_buffer
+            oled_buffer type pointer
+    @param  x
+            column of the view the bitmap lands on ( 0 based, may be outside the view ).
+    @param  y
+            row of the view the bitmap lands on ( 0 based, may be outside the view ).
+    @param  bitmap
+            page-major bitmap ( vertical 1 byte mode ), ( height + 7 ) / 8 page rows of width bytes.
+    @param  width
+            width of the bitmap.
+    @param  height
+            height of the bitmap.
+    @param  op
+            BLIT_COPY, BLIT_OR, BLIT_AND, BLIT_XOR or BLIT_AND_NOT.
+    @return None (void)
+    @note   the bitmap is clipped to the view, see ssd1306_blit_oled_area to place part of a bitmap.
+*/
+void ssd1306_blit_oled_bitmap(oled_buffer *oled_user_buffer, int32_t x, int32_t y, const uint8_t *bitmap, uint16_t width, uint16_t height, blit_op op)
+{
+    ssd1306_blit_oled_area(oled_user_buffer, x, y, bitmap, width, 0, 0, width, height, op);
+}
+
+
+/*!
+    @brief  check if the view covers the whole screen.
+    @param  oled_user_buffer
+            oled_buffer pointer created by the viewbox function.
+    @return 1 for a full screen view, 0 otherwise.
+*/
+static uint8_t ssd1306_oled_view_is_full_screen(const oled_buffer *oled_user_buffer)
+{
+    return oled_user_buffer->col_pos == 1 && oled_user_buffer->page_pos == 1 &&
+           oled_user_buffer->width == OLED_WIDTH && oled_user_buffer->page == OLED_PAGES;
+}
+
+
+/*!
+    @brief  vertical origin of the view which has to be applied in software.
+    @param  oled_user_buffer
+            oled_buffer pointer created by the viewbox function.
+    @return row origin, 0 for a full screen view as the display start line moves it.
+*/
+static uint16_t ssd1306_oled_view_soft_rows(const oled_buffer *oled_user_buffer)
+{
+    return ssd1306_oled_view_is_full_screen(oled_user_buffer) ? 0 : oled_user_buffer->row_origin;
+}
+
+
+/*!
+    @brief  send the display start line to the ssd1306, the flush lock is already held.
+    @param  line
+            GDDRAM row shown on the top row of the screen ( 0 - 63 ).
+    @return None (Void)
+*/
+static void ssd1306_set_oled_start_line(uint8_t line)
+{
+    ssd1306_send_oled_command(OLED_SET_DISPLAY_START_LINE | (line & 0x3F));
+    oled_start_line = line;
+}
+
+
+/*!
+    @brief  reverse a run of bytes in place.
+    @param  data
+            first byte of the run.
+    @param  length
+            number of bytes.
+    @return None (Void)
+*/
+static void ssd1306_reverse_oled_bytes(uint8_t *data, uint32_t length)
+{
+    for (uint32_t i = 0, j = length - 1; i < j; i++, j--)
+    {
+        uint8_t byte = data[i];
+        data[i] = data[j];
+        data[j] = byte;
+    }
+}
+
+
+/*!
+    @brief  move whole pages of the view down, the pages leaving the bottom come back on top.
+    @param  oled_user_buffer
+            oled_buffer pointer created by the viewbox function.
+    @param  pages
+            pages to move by ( 0 < pages < page count ).
+    @return None (Void)
+    @note   the page rows are rotated in place with three reversals, no scratch buffer is needed.
+*/
+static void ssd1306_rotate_oled_view_pages(oled_buffer *oled_user_buffer, uint32_t pages)
+{
+    uint8_t *data = &oled_user_buffer->oled_user_buffer[1];
+    uint32_t size = oled_user_buffer->page * oled_user_buffer->width;
+    uint32_t split = size - (pages * oled_user_buffer->width);
+
+    ssd1306_reverse_oled_bytes(data, split);
+    ssd1306_reverse_oled_bytes(&data[split], size - split);
+    ssd1306_reverse_oled_bytes(data, size);
+}
+
+
+/*!
+    @brief  shift every column of the view by 1 to 7 bits, the bits leaving one end come back at the other.
+    @param  oled_user_buffer
+            oled_buffer pointer created by the viewbox function.
+    @param  bits
+            bits to shift by ( 1 - 7 ).
+    @param  down
+            1 to move the pixels down ( towards the MSB and the next page ), 0 to move them up.
+    @return None (Void)
+    @note   four adjacent columns are shifted at once in a 32 bit word, every byte lane keeps its own
+            column and takes the carry from the same lane of the neighbouring page.
+            pages are walked against the direction of the carry so each page still reads its old neighbour,
+            only the page the wrap around comes from is saved first.
+*/
+static void ssd1306_shift_oled_view_bits(oled_buffer *oled_user_buffer, uint32_t bits, uint8_t down)
+{
+    uint8_t *data = &oled_user_buffer->oled_user_buffer[1];
+    uint32_t width = oled_user_buffer->width;
+    uint32_t last = oled_user_buffer->page - 1;
+    uint32_t keep_mask = 0x01010101u * (down ? ((0xFFu << bits) & 0xFF) : (0xFFu >> bits));
+    uint32_t carry_mask = ~keep_mask;
+    uint32_t col = 0;
+
+    for (; col + 4 <= width; col += 4)
     {
-        for (int page = 0; page < steps; page++)
+        uint32_t word, neighbour, wrap;
+
+        if (down)
         {
-            uint8_t *page_start = oled_user_buffer->oled_user_buffer + (page * oled_user_buffer->width);
-            uint8_t temp = page_start[oled_user_buffer->width]; // store first byte
-            for (int col = oled_user_buffer->width; col > 1; col--)
+            memcpy(&wrap, &data[(last * width) + col], 4);
+            for (uint32_t page = last; page > 0; page--)
             {
-                page_start[col] = page_start[col - 1];
+                memcpy(&word, &data[(page * width) + col], 4);
+                memcpy(&neighbour, &data[((page - 1) * width) + col], 4);
+                word = ((word << bits) & keep_mask) | ((neighbour >> (8 - bits)) & carry_mask);
+                memcpy(&data[(page * width) + col], &word, 4);
             }
-
-            // Wrap the first data byte to the end
-            page_start[1] = temp;
+            memcpy(&word, &data[col], 4);
+            word = ((word << bits) & keep_mask) | ((wrap >> (8 - bits)) & carry_mask);
+            memcpy(&data[col], &word, 4);
         }
-        ssd1306_send_oled_display_buffer(oled_user_buffer);
-    }
-    if (direction == VERTICAL_DOWN)
-    {
-        int width = oled_user_buffer->width;
-        int pages = oled_user_buffer->page - 1;
-
-        for (int col = 1; col <= steps; col++)
+        else
         {
-            uint8_t carry = (oled_user_buffer->oled_user_buffer[(pages * width) + col] & 0x80) >> 7;
-
-            for (int page = 0; page <= pages; page++)
+            memcpy(&wrap, &data[col], 4);
+            for (uint32_t page = 0; page < last; page++)
             {
-                uint8_t *byte = &oled_user_buffer->oled_user_buffer[page * width + col];
-                uint8_t new_carry = (*byte & 0x80) >> 7; // get MSB before shifting
-                *byte = (*byte << 1) | carry;            // shift and insert carry
-                carry = new_carry;
+                memcpy(&word, &data[(page * width) + col], 4);
+                memcpy(&neighbour, &data[((page + 1) * width) + col], 4);
+                word = ((word >> bits) & keep_mask) | ((neighbour << (8 - bits)) & carry_mask);
+                memcpy(&data[(page * width) + col], &word, 4);
             }
+            memcpy(&word, &data[(last * width) + col], 4);
+            word = ((word >> bits) & keep_mask) | ((wrap << (8 - bits)) & carry_mask);
+            memcpy(&data[(last * width) + col], &word, 4);
         }
+    }
 
-        ssd1306_send_oled_display_buffer(oled_user_buffer);
+    // remaining columns when the width is not a multiple of 4.
+    for (; col < width; col++)
+    {
+        if (down)
+        {
+            uint8_t wrap = data[(last * width) + col];
+            for (uint32_t page = last; page > 0; page--)
+                data[(page * width) + col] = (data[(page * width) + col] << bits) | (data[((page - 1) * width) + col] >> (8 - bits));
+            data[col] = (data[col] << bits) | (wrap >> (8 - bits));
+        }
+        else
+        {
+            uint8_t wrap = data[col];
+            for (uint32_t page = 0; page < last; page++)
+                data[(page * width) + col] = (data[(page * width) + col] >> bits) | (data[((page + 1) * width) + col] << (8 - bits));
+            data[(last * width) + col] = (data[(last * width) + col] >> bits) | (wrap << (8 - bits));
+        }
     }
-    if (direction == VERTICAL_UP)
+}
+
+
+/*!
+    @brief  shift the content of the view vertically by some pixels, the content wraps around the view.
+    @param  oled_user_buffer
+            oled_buffer pointer created by the viewbox function.
+    @param  rows
+            pixels to shift by, positive to the top and negative to the bottom.
+    @return None (Void)
+    @note   multiples of 8 move whole pages, the remaining 1 to 7 bits are shifted word by word.
+            the whole view is marked dirty.
+*/
+void ssd1306_shift_oled_view_rows(oled_buffer *oled_user_buffer, int32_t rows)
+{
+    int32_t height = oled_user_buffer->page * 8;
+    uint8_t down = rows < 0;
+    uint32_t pixels = (down ? -rows : rows) % height;
+    if (pixels == 0)
+        return;
+
+    ssd1306_begin_oled_draw(oled_user_buffer);
+    if (pixels / 8)
     {
-        int width = oled_user_buffer->width;
-        int pages = oled_user_buffer->page - 1;
+        uint32_t pages = pixels / 8;
+        ssd1306_rotate_oled_view_pages(oled_user_buffer, down ? pages : oled_user_buffer->page - pages);
+    }
+    if (pixels % 8)
+        ssd1306_shift_oled_view_bits(oled_user_buffer, pixels % 8, down);
 
-        for (int col = 1; col <= steps; col++)
-        {
-            uint8_t carry = (oled_user_buffer->oled_user_buffer[col] & 0x01) << 7;
+    ssd1306_mark_oled_view_dirty(oled_user_buffer, 0, oled_user_buffer->width - 1, 0, oled_user_buffer->page - 1);
+    ssd1306_end_oled_draw(oled_user_buffer);
+}
 
-            for (int page = pages; page >= 0; page--)
-            {
-                uint8_t *byte = &oled_user_buffer->oled_user_buffer[page * width + col];
-                uint8_t new_carry = (*byte & 0x01) << 7;
-                *byte = (*byte >> 1) | carry;
-                carry = new_carry;
-            }
-        }
+
+/*!
+    @brief  scroll the view vertically, the content wraps around the view.
+    @param  oled_user_buffer
+            oled_buffer pointer created by the viewbox function.
+    @param  rows
+            pixels to move the content by, positive to the top and negative to the bottom.
+    @return None (Void)
+    @note   the buffer is not touched, only row_origin moves, so drawing stays in buffer coordinates.
+            a full screen view is moved with the display start line of the ssd1306, it costs a single
+            command and a flush only sends what was drawn. other views apply the origin when they are
+            sent and are marked dirty. the origin and the start line change under the flush lock, so a flush
+            from another task never sees them half way.
+*/
+void ssd1306_roll_oled_view(oled_buffer *oled_user_buffer, int32_t rows)
+{
+    int32_t height = oled_user_buffer->page * 8;
+    rows %= height;
+
+    xSemaphoreTake(oled_flush_lock, portMAX_DELAY);
+    oled_user_buffer->row_origin = (oled_user_buffer->row_origin + rows + height) % height;
+    if (ssd1306_oled_view_is_full_screen(oled_user_buffer))
+        ssd1306_set_oled_start_line(oled_user_buffer->row_origin);
+    else
+        ssd1306_mark_oled_view_dirty(oled_user_buffer, 0, oled_user_buffer->width - 1, 0, oled_user_buffer->page - 1);
+    xSemaphoreGive(oled_flush_lock);
+}
+
+
+/*!
+    @brief  rotate the content of every page row of the view by some columns.
+    @param  oled_user_buffer
+            oled_buffer pointer created by the viewbox function.
+    @param  columns
+            columns to move the content by, positive to the left and negative to the right.
+    @return None (Void)
+*/
+static void ssd1306_shift_oled_view_cols(oled_buffer *oled_user_buffer, int32_t columns)
+{
+    int32_t width = oled_user_buffer->width;
+    int32_t left = ((columns % width) + width) % width;
+    if (left == 0)
+        return;
+
+    uint8_t wrap[OLED_WIDTH];
+    for (int page = 0; page < oled_user_buffer->page; page++)
+    {
+        uint8_t *row = &oled_user_buffer->oled_user_buffer[1 + (page * width)];
+        memcpy(wrap, row, left);
+        memmove(row, &row[left], width - left);
+        memcpy(&row[width - left], wrap, left);
+    }
+}
+
+
+/*!
+    @brief  shift the oled buffer.
+    @param  oled_user_buffer
+            oled_buffer type pointer
+    @param  direction
+            you may choose from enum values, HORIZONTAL_LEFT, HORIZONTAL_RIGHT, VERTICAL_DOWN, VERTICAL_UP
+    @param  steps
+            number of step with you want to shift your buffer.
+    @return None (void)
+    @note   it shift oled buffer by 1 bit therefore 1 step = 1 bit shift ( 1 column horizontally ).
+            the content of the buffer moves and wraps around, so later drawing stays in screen coordinates.
+            to scroll without touching the buffer use ssd1306_rotate_oled_view / ssd1306_roll_oled_view.
+*/
+void ssd1306_shift_oled_buffer(oled_buffer *oled_user_buffer, scroll_type direction, uint32_t steps)
+{
+    if (direction == VERTICAL_DOWN || direction == VERTICAL_UP)
+    {
+        int32_t rows = steps % (oled_user_buffer->page * 8);
+        ssd1306_shift_oled_view_rows(oled_user_buffer, direction == VERTICAL_UP ? rows : -rows);
+    }
+    else if (direction == HORIZONTAL_LEFT || direction == HORIZONTAL_RIGHT)
+    {
+        int32_t columns = steps % oled_user_buffer->width;
+        ssd1306_begin_oled_draw(oled_user_buffer);
+        ssd1306_shift_oled_view_cols(oled_user_buffer, direction == HORIZONTAL_LEFT ? columns : -columns);
+        ssd1306_mark_oled_view_dirty(oled_user_buffer, 0, oled_user_buffer->width - 1, 0, oled_user_buffer->page - 1);
+        ssd1306_end_oled_draw(oled_user_buffer);
     }
+    else
+        return;
+
+    ssd1306_send_oled_display_buffer(oled_user_buffer);
+}
+
+
+/*!
+    @brief  add the screen area of a view to a region.
+    @param  oled_user_buffer
+            oled_buffer pointer created by the viewbox function.
+    @param  region
+            region to grow, empty when page_start is UINT8_MAX.
+    @return None (Void)
+*/
+static void ssd1306_union_oled_view_area(const oled_buffer *oled_user_buffer, oled_window *region)
+{
+    int32_t col_start = (int32_t)oled_user_buffer->col_pos - 1;
+    int32_t page_start = (int32_t)oled_user_buffer->page_pos - 1;
+    int32_t col_end = col_start + oled_user_buffer->width - 1;
+    int32_t page_end = page_start + oled_user_buffer->page - 1;
+
+    if (col_start < 0) col_start = 0;
+    if (page_start < 0) page_start = 0;
+    if (col_end > OLED_WIDTH - 1) col_end = OLED_WIDTH - 1;
+    if (page_end > OLED_PAGES - 1) page_end = OLED_PAGES - 1;
+    if (col_start > col_end || page_start > page_end)
+        return;
+
+    if (col_start < region->col_start) region->col_start = col_start;
+    if (col_end > region->col_end) region->col_end = col_end;
+    if (page_start < region->page_start) region->page_start = page_start;
+    if (page_end > region->page_end) region->page_end = page_end;
 }
 
 
@@ -710,96 +2839,164 @@ void ssd1306_shift_oled_buffer(oled_buffer *oled_user_buffer, scroll_type direct
             takes a void pointer.
     @return None (void)
     @note   don't now call this function externaly, this task function is designed to called by only this library.
+            every view has its own deadline, each wakeup advances all the due views and sends them in one
+            diff flush when the screen content around them is known. with nothing scrolling the task blocks.
 */
 void scroll_task(void *pvargs)
 {
     active_scroll_view **views_pointer = (active_scroll_view **)pvargs;
 
-    TickType_t xLastWakeTime;
-    const TickType_t xFrequency = 20 / portTICK_PERIOD_MS; // 50ms between each frame (adjust as needed)
-    xLastWakeTime = xTaskGetTickCount();                   // initialize the wake time
-
-    active_scroll_view *current_scroll = *views_pointer;
     while (1)
     {
-        vTaskDelayUntil(&xLastWakeTime, xFrequency);
-        if(*views_pointer == NULL){
-            vTaskDelete(NULL);
-        }
-        if (current_scroll->view->scroll_type == HORIZONTAL_LEFT)
+        TickType_t wait = portMAX_DELAY;
+        oled_window region = {UINT8_MAX, 0, UINT8_MAX, 0};
+        uint8_t known = 1;
+
+        xSemaphoreTake(scroll_views_lock, portMAX_DELAY);
+        TickType_t now = xTaskGetTickCount();
+        active_scroll_view *head = *views_pointer;
+        active_scroll_view *current = head;
+
+        // advancing every due view and collecting the screen area they cover.
+        while (current != NULL)
         {
-            for (int page = 0; page < current_scroll->view->page; page++)
+            oled_buffer *view = current->view;
+            current->due = (TickType_t)(now - current->deadline) < (portMAX_DELAY / 2);
+            if (current->due)
             {
-                uint8_t *page_start = current_scroll->view->oled_user_buffer + (page * current_scroll->view->width);
-                uint8_t temp = page_start[1]; // store first byte
-                for (int col = 0; col < current_scroll->view->width; col++)
-                {
-                    page_start[col + 1] = page_start[col + 2];
-                }
-
-                // Wrap the first data byte to the end
-                page_start[current_scroll->view->width] = temp;
+                current->deadline += current->period;
+                if ((TickType_t)(now - current->deadline) < (portMAX_DELAY / 2))
+                    current->deadline = now + current->period; // missed frames are dropped, not caught up.
+
+                if (view->scroll_type == HORIZONTAL_LEFT) ssd1306_rotate_oled_view(view, current->step);
+                if (view->scroll_type == HORIZONTAL_RIGHT) ssd1306_rotate_oled_view(view, -(int32_t)current->step);
+                if (view->scroll_type == VERTICAL_UP) ssd1306_roll_oled_view(view, current->step);
+                if (view->scroll_type == VERTICAL_DOWN) ssd1306_roll_oled_view(view, -(int32_t)current->step);
+
+                // a full screen view may only have moved the start line.
+                oled_dirty_region dirty = ssd1306_get_oled_view_dirty(view);
+                current->due = dirty.col_start <= dirty.col_end;
+                if (current->due)
+                    ssd1306_union_oled_view_area(view, &region);
             }
-            ssd1306_send_oled_display_buffer(current_scroll->view);
+
+            TickType_t remaining = current->deadline - now;
+            if (remaining < wait)
+                wait = remaining;
+
+            current = current->next_view != head ? current->next_view : NULL;
         }
-        if (current_scroll->view->scroll_type == HORIZONTAL_RIGHT)
+
+        if (region.page_start != UINT8_MAX)
         {
-            for (int page = 0; page < current_scroll->view->page; page++)
-            {
-                uint8_t *page_start = current_scroll->view->oled_user_buffer + (page * current_scroll->view->width);
-                uint8_t temp = page_start[current_scroll->view->width]; // store first byte
-                for (int col = current_scroll->view->width; col > 1; col--)
-                {
-                    page_start[col] = page_start[col - 1];
-                }
-
-                // Wrap the first data byte to the end
-                page_start[1] = temp;
-            }
-            ssd1306_send_oled_display_buffer(current_scroll->view);
+            // the shadow is only trusted while the flush lock is held, another task's flush may drop it.
+            xSemaphoreTake(oled_flush_lock, portMAX_DELAY);
+            for (uint8_t page = region.page_start; page <= region.page_end && page < OLED_PAGES; page++)
+                known &= (oled_shadow_valid_pages >> page) & 1;
         }
-        if (current_scroll->view->scroll_type == VERTICAL_DOWN)
-        {
-            int width = current_scroll->view->width;
-            int pages = current_scroll->view->page - 1;
-
-            for (int col = 1; col <= width; col++)
-            {
-                uint8_t carry = (current_scroll->view->oled_user_buffer[(pages * width) + col] & 0x80) >> 7;
-
-                for (int page = 0; page <= pages; page++)
-                {
-                    uint8_t *byte = &current_scroll->view->oled_user_buffer[page * width + col];
-                    uint8_t new_carry = (*byte & 0x80) >> 7; // get MSB before shifting
-                    *byte = (*byte << 1) | carry;            // shift and insert carry
-                    carry = new_carry;
-                }
-            }
 
-            ssd1306_send_oled_display_buffer(current_scroll->view);
+        if (region.page_start != UINT8_MAX && known)
+        {
+            // one diff over the whole area, the stage around the views is what the screen shows.
+            // a view which is being drawn keeps the screen content and is sent on its next step.
+            for (uint8_t page = region.page_start; page <= region.page_end; page++)
+                memcpy(&oled_stage[page][region.col_start], &oled_gddram_shadow[page][region.col_start], region.col_end - region.col_start + 1);
+
+            oled_window staged;
+            for (current = head; current != NULL; current = current->next_view != head ? current->next_view : NULL)
+                if (current->due)
+                    ssd1306_stage_oled_view(current->view, &staged, 0);
+            ssd1306_flush_oled_stage(&region);
+            xSemaphoreGive(oled_flush_lock);
         }
-        if (current_scroll->view->scroll_type == VERTICAL_UP)
+        else if (region.page_start != UINT8_MAX)
         {
-            int width = current_scroll->view->width;
-            int pages = current_scroll->view->page - 1;
-
-            for (int col = 1; col <= width; col++)
-            {
-                uint8_t carry = (current_scroll->view->oled_user_buffer[col] & 0x01) << 7;
-
-                for (int page = pages; page >= 0; page--)
-                {
-                    uint8_t *byte = &current_scroll->view->oled_user_buffer[page * width + col];
-                    uint8_t new_carry = (*byte & 0x01) << 7;
-                    *byte = (*byte >> 1) | carry;
-                    carry = new_carry;
-                }
-            }
-            ssd1306_send_oled_display_buffer(current_scroll->view);
+            xSemaphoreGive(oled_flush_lock);
+            for (current = head; current != NULL; current = current->next_view != head ? current->next_view : NULL)
+                if (current->due)
+                    ssd1306_send_oled_display_buffer(current->view);
         }
-        current_scroll = current_scroll->next_view != NULL ? current_scroll->next_view : *views_pointer;
+        xSemaphoreGive(scroll_views_lock);
+
+        // sleeping until the next view is due, or until a view starts scrolling.
+        xSemaphoreTake(scroll_wakeup, wait);
     }
-    vTaskDelete(NULL);
+}
+
+
+/*!
+    @brief  check if the controller can scroll the view by itself.
+    @param  oled_user_buffer
+            oled_buffer pointer created by the viewbox function.
+    @param  scroll
+            requested scroll type.
+    @return 1 when the hardware scroll can be used, 0 otherwise.
+    @note   the ssd1306 scrolls whole pages horizontally, so the view has to cover the full width
+            of the screen and be fully visible. only one page range can scroll at a time.
+*/
+static uint8_t ssd1306_oled_hw_scroll_eligible(const oled_buffer *oled_user_buffer, scroll_type scroll)
+{
+#if OLED_HW_SCROLL
+    if (scroll != HORIZONTAL_LEFT && scroll != HORIZONTAL_RIGHT)
+        return 0;
+    if (oled_hw_scroll_view != NULL)
+        return 0;
+
+    return oled_user_buffer->col_pos == 1 && oled_user_buffer->width == OLED_WIDTH &&
+           oled_user_buffer->page_pos >= 1 && oled_user_buffer->page_pos - 1 + oled_user_buffer->page <= OLED_PAGES;
+#else
+    (void)oled_user_buffer;
+    (void)scroll;
+    return 0;
+#endif
+}
+
+
+/*!
+    @brief  program and start the hardware scroll for the pages of the view, the flush lock is already held.
+    @param  oled_user_buffer
+            oled_buffer pointer, already written to the screen.
+    @return None (Void)
+    @note   the controller moves its GDDRAM on its own from now on, the shadow of those pages is dropped.
+*/
+static void ssd1306_start_oled_hw_scroll(oled_buffer *oled_user_buffer)
+{
+    uint8_t start_page = oled_user_buffer->page_pos - 1;
+    uint8_t end_page = start_page + oled_user_buffer->page - 1;
+    const uint8_t args[6] = {0x00, start_page, OLED_HW_SCROLL_INTERVAL, end_page, 0x00, 0xFF};
+
+    oled_command_queue queue;
+    ssd1306_begin_oled_commands(&queue);
+    ssd1306_queue_oled_command_args(&queue, oled_user_buffer->scroll_type == HORIZONTAL_LEFT ? OLED_LEFT_HORIZONTAL_SCROLL : OLED_RIGHT_HORIZONTAL_SCROLL, args, sizeof(args));
+    ssd1306_queue_oled_command(&queue, OLED_START_SCROLLING);
+    ssd1306_send_oled_commands(&queue);
+
+    for (uint8_t page = start_page; page <= end_page; page++)
+        oled_shadow_valid_pages &= ~(1u << page);
+    oled_hw_scroll_view = oled_user_buffer;
+}
+
+
+/*!
+    @brief  stop the hardware scroll of a view, the flush lock is already held.
+    @param  oled_user_buffer
+            oled_buffer pointer created by the viewbox function.
+    @return scroll type the controller was running, NO_SCROLL if the view wasn't scrolled by it.
+    @note   GDDRAM must not be written while the controller scrolls. the view is left not scrolling
+            and fully dirty, as the controller leaves its pages shifted.
+*/
+static scroll_type ssd1306_release_oled_hw_scroll(oled_buffer *oled_user_buffer)
+{
+    if (oled_user_buffer != oled_hw_scroll_view)
+        return NO_SCROLL;
+
+    ssd1306_send_oled_command(OLED_STOP_SCROLLING);
+    oled_hw_scroll_view = NULL;
+
+    scroll_type scroll = oled_user_buffer->scroll_type;
+    oled_user_buffer->scroll_type = NO_SCROLL;
+    ssd1306_mark_oled_view_dirty(oled_user_buffer, 0, oled_user_buffer->width - 1, 0, oled_user_buffer->page - 1);
+    return scroll;
 }
 
 
@@ -811,8 +3008,43 @@ void scroll_task(void *pvargs)
             you may choose from enum values, HORIZONTAL_LEFT, HORIZONTAL_RIGHT, VERTICAL_DOWN, VERTICAL_UP
     @return None (void)
     @note   you can't pass another scrolling type to a buffer without stopping it first.
+            a full width horizontal scroll runs on the ssd1306 itself ( see OLED_HW_SCROLL ),
+            everything else is scrolled by the scroll task. the controller can't be written while it
+            scrolls, so the first flush of a hardware scrolled view hands it over to the scroll task:
+            the view restarts once from its origin and is scrolled in software from then on. start the
+            scroll after the last update of a view which is flushed repeatedly ( e.g. an animation ).
 */
 void ssd1306_scroll_oled_view(oled_buffer *oled_user_buffer, scroll_type scroll)
+{
+    xSemaphoreTake(oled_flush_lock, portMAX_DELAY);
+    if (ssd1306_oled_hw_scroll_eligible(oled_user_buffer, scroll) && oled_user_buffer->scroll_type == NO_SCROLL)
+    {
+        ssd1306_flush_oled_view(oled_user_buffer);
+        oled_user_buffer->scroll_type = scroll;
+        ssd1306_start_oled_hw_scroll(oled_user_buffer);
+        xSemaphoreGive(oled_flush_lock);
+        return;
+    }
+    xSemaphoreGive(oled_flush_lock);
+
+    ssd1306_scroll_oled_view_rate(oled_user_buffer, scroll, OLED_SCROLL_PERIOD_MS, 1);
+}
+
+
+/*!
+    @brief  scroll your oled buffer at its own speed in software.
+    @param  oled_user_buffer
+            oled_buffer type pointer
+    @param  scroll
+            you may choose from enum values, HORIZONTAL_LEFT, HORIZONTAL_RIGHT, VERTICAL_DOWN, VERTICAL_UP
+    @param  period_ms
+            time between two steps of this view.
+    @param  step
+            pixels moved on every step.
+    @return None (void)
+    @note   you can't pass another scrolling type to a buffer without stopping it first.
+*/
+void ssd1306_scroll_oled_view_rate(oled_buffer *oled_user_buffer, scroll_type scroll, uint32_t period_ms, uint16_t step)
 {
     if (scroll_views_pointer_head == NULL) {
         ESP_LOGE(TAG, "scroll_views_pointer_head is NULL. Cannot proceed.");
@@ -825,7 +3057,15 @@ void ssd1306_scroll_oled_view(oled_buffer *oled_user_buffer, scroll_type scroll)
         return;
     }
 
-    oled_user_buffer->scroll_type = scroll;
+    if (!scroll_views_lock)
+    {
+        scroll_views_lock = xSemaphoreCreateMutex();
+        scroll_wakeup = xSemaphoreCreateBinary();
+        if (!scroll_views_lock || !scroll_wakeup) {
+            ESP_LOGE(TAG, "Memory allocation failed for the scroll task.");
+            return;
+        }
+    }
 
     active_scroll_view *scroll_view = malloc(sizeof(active_scroll_view));
     if (!scroll_view) {
@@ -833,7 +3073,15 @@ void ssd1306_scroll_oled_view(oled_buffer *oled_user_buffer, scroll_type scroll)
         return;
     }
 
+    TickType_t period = pdMS_TO_TICKS(period_ms);
     scroll_view->view = oled_user_buffer;
+    scroll_view->period = period > 0 ? period : 1;
+    scroll_view->step = step;
+    scroll_view->deadline = xTaskGetTickCount() + scroll_view->period;
+    scroll_view->due = 0;
+
+    xSemaphoreTake(scroll_views_lock, portMAX_DELAY);
+    oled_user_buffer->scroll_type = scroll;
 
     if (*scroll_views_pointer_head == NULL) {
         scroll_view->prev_view = scroll_view;
@@ -848,10 +3096,12 @@ void ssd1306_scroll_oled_view(oled_buffer *oled_user_buffer, scroll_type scroll)
         head->prev_view = scroll_view;
         last->next_view = scroll_view;
     }
+    xSemaphoreGive(scroll_views_lock);
 
     if (!activate_scroll) {
         xTaskCreate(scroll_task, "ssd1306_scroll_task", 2048, (void *)scroll_views_pointer_head, 2, &activate_scroll);
     }
+    xSemaphoreGive(scroll_wakeup);  // the task recomputes its next deadline.
 }
 
 /*!
@@ -869,12 +3119,20 @@ void ssd1306_scroll_stop_oled_view(oled_buffer *oled_user_buffer)
         return;
     }
 
+    if (oled_user_buffer == oled_hw_scroll_view)
+    {
+        ssd1306_scroll_oled_stop();
+        ESP_LOGI(TAG, "Hardware scroll stopped.");
+        return;
+    }
+
     if (scroll_views_pointer_head == NULL || *scroll_views_pointer_head == NULL)
     {
         ESP_LOGE(TAG, "scroll_views_pointer_head is NULL. Cannot stop scroll.");
         return;
     }
 
+    xSemaphoreTake(scroll_views_lock, portMAX_DELAY);
     active_scroll_view *current = *scroll_views_pointer_head;
     active_scroll_view *start = current;
     do
@@ -884,9 +3142,8 @@ void ssd1306_scroll_stop_oled_view(oled_buffer *oled_user_buffer)
             // Disconnect from linked list
             if (current->next_view == current && current->prev_view == current)
             {
-                // Only one in list
+                // Only one in list, the task stays blocked until the next view scrolls.
                 *scroll_views_pointer_head = NULL;
-                activate_scroll = NULL;
             }
             else
             {
@@ -899,17 +3156,16 @@ void ssd1306_scroll_stop_oled_view(oled_buffer *oled_user_buffer)
 
             // Stop scroll in buffer
             oled_user_buffer->scroll_type = NO_SCROLL;
+            xSemaphoreGive(scroll_views_lock);
 
-            // Free view
-            // free(current);
+            // the task only walks the list while holding the lock, so the node can go.
+            free(current);
             ESP_LOGI(TAG, "Scroll stopped and view removed.");
-            // eTaskState state = eTaskGetState(activate_scroll);
-            // ESP_LOGW(TAG, "Scroll task is not suspended, state: %d", state);
-            // vTaskResume(activate_scroll);
             return;
         }
         current = current->next_view;
     } while (current != start);
+    xSemaphoreGive(scroll_views_lock);
 
     ESP_LOGW(TAG, "Scroll view not found for given buffer.");
 }
\ No newline at end of file
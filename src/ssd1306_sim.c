@@ -0,0 +1,407 @@
+#include "ssd1306_sim.h"
+#include <stdlib.h>
+#include <string.h>
+
+// frames between two scroll steps for the 3 bit interval of the scroll setup commands.
+static const uint16_t sim_scroll_intervals[8] = {5, 64, 128, 256, 3, 4, 25, 2};
+
+
+/*!
+    @brief  reset the simulated controller to its power up state.
+    @param  sim
+            simulator state.
+    @return None (Void)
+    @note   the GDDRAM is cleared to 0x00, a real panel holds random data at power up.
+*/
+void ssd1306_sim_init(ssd1306_sim *sim)
+{
+    memset(sim, 0, sizeof(ssd1306_sim));
+    sim->address_mode = 2;                      // page addressing is the reset default
+    sim->col_end = OLED_WIDTH - 1;
+    sim->page_end = OLED_PAGES - 1;
+    sim->contrast = 0x7F;
+    sim->scroll_area_rows = SSD1306_SIM_ROWS;
+}
+
+
+/*!
+    @brief  reset the traffic counters of the simulator.
+    @param  sim
+            simulator state.
+    @return None (Void)
+*/
+void ssd1306_sim_reset_counters(ssd1306_sim *sim)
+{
+    sim->transactions = 0;
+    sim->command_transactions = 0;
+    sim->data_transactions = 0;
+    sim->bytes = 0;
+    sim->command_bytes = 0;
+    sim->data_bytes = 0;
+    sim->unknown_commands = 0;
+}
+
+
+/*!
+    @brief  number of argument bytes following a command.
+    @param  command
+            ssd1306 command.
+    @return argument count.
+*/
+static uint8_t ssd1306_sim_argument_count(uint8_t command)
+{
+    switch (command)
+    {
+    case OLED_SET_COL_ADDRESS:
+    case OLED_SET_PAGE_ADDRESS:
+    case OLED_SET_VERTICAL_SCROLL_AREA:
+        return 2;
+    case OLED_RIGHT_HORIZONTAL_SCROLL:
+    case OLED_LEFT_HORIZONTAL_SCROLL:
+        return 6;
+    case OLED_VER_RIGHT_HORIZ_SCROLL:
+    case OLED_VER_LEFT_HORIZ_SCROLL:
+        return 5;
+    case OLED_SET_CONTRAST_CONTROL:
+    case OLED_SET_MEMORY_ADDRESS_MODE:
+    case OLED_SET_MULTIPLEX_RATIO:
+    case OLED_SET_DISPLAY_OFFSET:
+    case OLED_SET_COM_PIN:
+    case OLED_SET_CLOCK_DIVIDE_RATIO:
+    case OLED_SET_PRECHARGE_PERIOD:
+    case OLED_SET_VCOM_DESELECT_LEVEL:
+    case OLED_CHARGE_PUMP_SETTING:
+        return 1;
+    default:
+        return 0;
+    }
+}
+
+
+/*!
+    @brief  execute a complete command held in the parser.
+    @param  sim
+            simulator state.
+    @return None (Void)
+*/
+static void ssd1306_sim_execute(ssd1306_sim *sim)
+{
+    const uint8_t *cmd = sim->command;
+
+    switch (cmd[0])
+    {
+    case OLED_SET_COL_ADDRESS:
+        sim->col_start = cmd[1] & 0x7F;
+        sim->col_end = cmd[2] & 0x7F;
+        sim->col = sim->col_start;
+        return;
+    case OLED_SET_PAGE_ADDRESS:
+        sim->page_start = cmd[1] & 0x07;
+        sim->page_end = cmd[2] & 0x07;
+        sim->page = sim->page_start;
+        return;
+    case OLED_SET_MEMORY_ADDRESS_MODE:
+        sim->address_mode = cmd[1] & 0x03;
+        return;
+    case OLED_SET_CONTRAST_CONTROL:
+        sim->contrast = cmd[1];
+        return;
+    case OLED_SET_DISPLAY_OFFSET:
+        sim->display_offset = cmd[1] & 0x3F;
+        return;
+    case OLED_SET_VERTICAL_SCROLL_AREA:
+        sim->scroll_area_top = cmd[1] & 0x3F;
+        sim->scroll_area_rows = cmd[2] & 0x7F;
+        return;
+    case OLED_RIGHT_HORIZONTAL_SCROLL:
+    case OLED_LEFT_HORIZONTAL_SCROLL:
+    case OLED_VER_RIGHT_HORIZ_SCROLL:
+    case OLED_VER_LEFT_HORIZ_SCROLL:
+        sim->scroll_command = cmd[0];
+        sim->scroll_start_page = cmd[2] & 0x07;
+        sim->scroll_interval = cmd[3] & 0x07;
+        sim->scroll_end_page = cmd[4] & 0x07;
+        sim->scroll_vertical_offset = (cmd[0] == OLED_VER_RIGHT_HORIZ_SCROLL || cmd[0] == OLED_VER_LEFT_HORIZ_SCROLL) ? (cmd[5] & 0x3F) : 0;
+        return;
+    case OLED_STOP_SCROLLING:
+        sim->scroll_active = 0;
+        return;
+    case OLED_START_SCROLLING:
+        sim->scroll_active = 1;
+        sim->scroll_frame = 0;
+        sim->scroll_vertical_position = 0;
+        return;
+    case OLED_ENTIRE_DISPLAY_ON_RAM_CONTENT:
+    case OLED_ENTIRE_DISPLAY_LED_ON:
+        sim->entire_on = cmd[0] & 0x01;
+        return;
+    case OLED_SET_NORMAL_DISPLAY:
+    case OLED_SET_INVERSE_DISPLAY:
+        sim->inverse = cmd[0] & 0x01;
+        return;
+    case OLED_SET_DISPLAY_OFF:
+    case OLED_SET_DISPLAY_ON:
+        sim->display_on = cmd[0] & 0x01;
+        return;
+    case OLED_SET_MULTIPLEX_RATIO:
+    case OLED_SET_COM_PIN:
+    case OLED_SET_CLOCK_DIVIDE_RATIO:
+    case OLED_SET_PRECHARGE_PERIOD:
+    case OLED_SET_VCOM_DESELECT_LEVEL:
+    case OLED_CHARGE_PUMP_SETTING:
+    case OLED_SET_SEGMENT_REMAP:
+    case OLED_SET_SEGMENT_REMAP & 0xFE:
+    case OLED_SET_COM_OUPUT_SCAN_NORMAL:
+    case OLED_SET_COM_OUTPUT_SCAN_REMAPPED:
+    case OLED_NO_OPERATION:
+        return; // accepted, no effect on the simulated picture.
+    default:
+        break;
+    }
+
+    if (cmd[0] <= 0x0F)
+    {
+        sim->page_mode_col_start = (sim->page_mode_col_start & 0xF0) | (cmd[0] & 0x0F);
+        sim->col = sim->page_mode_col_start;
+    }
+    else if (cmd[0] <= 0x1F)
+    {
+        sim->page_mode_col_start = ((cmd[0] & 0x07) << 4) | (sim->page_mode_col_start & 0x0F);
+        sim->col = sim->page_mode_col_start;
+    }
+    else if (cmd[0] >= OLED_SET_DISPLAY_START_LINE && cmd[0] <= (OLED_SET_DISPLAY_START_LINE | 0x3F))
+        sim->start_line = cmd[0] & 0x3F;
+    else if (cmd[0] >= OLED_SET_PAGE_START_ADDRESS && cmd[0] <= (OLED_SET_PAGE_START_ADDRESS | 0x07))
+        sim->page = cmd[0] & 0x07;
+    else
+        sim->unknown_commands++;
+}
+
+
+/*!
+    @brief  feed one command byte to the parser.
+    @param  sim
+            simulator state.
+    @param  byte
+            command or argument byte.
+    @return None (Void)
+*/
+static void ssd1306_sim_command_byte(ssd1306_sim *sim, uint8_t byte)
+{
+    if (sim->command_length == 0)
+        sim->command_expected = ssd1306_sim_argument_count(byte);
+
+    sim->command[sim->command_length++] = byte;
+    if (sim->command_length > sim->command_expected)
+    {
+        ssd1306_sim_execute(sim);
+        sim->command_length = 0;
+    }
+}
+
+
+/*!
+    @brief  write one data byte at the RAM pointer and advance it for the addressing mode.
+    @param  sim
+            simulator state.
+    @param  byte
+            data byte.
+    @return None (Void)
+*/
+static void ssd1306_sim_data_byte(ssd1306_sim *sim, uint8_t byte)
+{
+    sim->gddram[sim->page & 0x07][sim->col & 0x7F] = byte;
+
+    if (sim->address_mode == 0)
+    {
+        if (++sim->col > sim->col_end)
+        {
+            sim->col = sim->col_start;
+            if (++sim->page > sim->page_end)
+                sim->page = sim->page_start;
+        }
+    }
+    else if (sim->address_mode == 1)
+    {
+        if (++sim->page > sim->page_end)
+        {
+            sim->page = sim->page_start;
+            if (++sim->col > sim->col_end)
+                sim->col = sim->col_start;
+        }
+    }
+    else
+    {
+        if (++sim->col > OLED_WIDTH - 1)
+            sim->col = sim->page_mode_col_start;
+    }
+}
+
+
+/*!
+    @brief  feed one bus transaction ( the bytes after the address ) to the simulator.
+    @param  sim
+            simulator state.
+    @param  buffer
+            transaction bytes, starting with a control byte.
+    @param  size
+            size of the buffer.
+    @return None (Void)
+    @note   a control byte with Co = 0 makes the rest of the transaction data ( D/C = 1 ) or commands ( D/C = 0 ),
+            with Co = 1 only the next byte is taken and another control byte follows.
+*/
+void ssd1306_sim_feed(ssd1306_sim *sim, const uint8_t *buffer, size_t size)
+{
+    if (size == 0)
+        return;
+
+    sim->transactions++;
+    sim->bytes += size;
+    if (buffer[0] & 0x40)
+    {
+        sim->data_transactions++;
+        sim->data_bytes += size;
+    }
+    else
+    {
+        sim->command_transactions++;
+        sim->command_bytes += size;
+    }
+
+    size_t i = 0;
+    while (i < size)
+    {
+        uint8_t control = buffer[i++];
+        uint8_t is_data = control & 0x40;
+        size_t end = (control & 0x80) ? (i + 1 < size ? i + 1 : size) : size;
+
+        for (; i < end; i++)
+        {
+            if (is_data)
+                ssd1306_sim_data_byte(sim, buffer[i]);
+            else
+                ssd1306_sim_command_byte(sim, buffer[i]);
+        }
+    }
+}
+
+
+/*!
+    @brief  let the panel run for a number of frames, which only matters while scrolling.
+    @param  sim
+            simulator state.
+    @param  frames
+            number of display frames.
+    @return None (Void)
+    @note   each scroll step rotates the GDDRAM rows of the scrolled pages by one column,
+            continuous vertical scrolling moves the vertical scroll area by the programmed offset.
+*/
+void ssd1306_sim_advance_frames(ssd1306_sim *sim, uint32_t frames)
+{
+    if (!sim->scroll_active)
+        return;
+
+    uint16_t interval = sim_scroll_intervals[sim->scroll_interval];
+    uint8_t to_left = (sim->scroll_command == OLED_LEFT_HORIZONTAL_SCROLL || sim->scroll_command == OLED_VER_LEFT_HORIZ_SCROLL);
+
+    while (frames--)
+    {
+        if (++sim->scroll_frame < interval)
+            continue;
+        sim->scroll_frame = 0;
+
+        for (int page = sim->scroll_start_page; page <= sim->scroll_end_page; page++)
+        {
+            uint8_t *row = sim->gddram[page];
+            if (to_left)
+            {
+                uint8_t first = row[0];
+                memmove(&row[0], &row[1], OLED_WIDTH - 1);
+                row[OLED_WIDTH - 1] = first;
+            }
+            else
+            {
+                uint8_t last = row[OLED_WIDTH - 1];
+                memmove(&row[1], &row[0], OLED_WIDTH - 1);
+                row[0] = last;
+            }
+        }
+
+        if (sim->scroll_vertical_offset && sim->scroll_area_rows)
+            sim->scroll_vertical_position = (sim->scroll_vertical_position + sim->scroll_vertical_offset) % sim->scroll_area_rows;
+    }
+}
+
+
+/*!
+    @brief  read a pixel as the viewer sees it.
+    @param  sim
+            simulator state.
+    @param  x
+            screen column ( 0 - 127 ).
+    @param  y
+            screen row ( 0 - 63 ).
+    @return 1 for a lit pixel, 0 otherwise.
+    @note   display start line, display offset, vertical scrolling, inverse and entire display on are applied.
+            the segment remap and COM scan direction are taken as programmed by ssd1306_init_oled.
+*/
+uint8_t ssd1306_sim_get_pixel(const ssd1306_sim *sim, uint8_t x, uint8_t y)
+{
+    if (!sim->display_on)
+        return 0;
+    if (sim->entire_on)
+        return 1;
+
+    uint32_t row = y;
+    if (sim->scroll_vertical_position && row >= sim->scroll_area_top && row < (uint32_t)(sim->scroll_area_top + sim->scroll_area_rows))
+        row = sim->scroll_area_top + ((row - sim->scroll_area_top + sim->scroll_vertical_position) % sim->scroll_area_rows);
+    row = (row + sim->start_line + sim->display_offset) % SSD1306_SIM_ROWS;
+
+    uint8_t pixel = (sim->gddram[row / 8][x & 0x7F] >> (row % 8)) & 0x01;
+    return pixel ^ sim->inverse;
+}
+
+
+/*!
+    @brief  render the picture the viewer sees into a page-major frame.
+    @param  sim
+            simulator state.
+    @param  frame
+            output frame in the same layout as the GDDRAM.
+    @return None (Void)
+*/
+void ssd1306_sim_render(const ssd1306_sim *sim, uint8_t frame[OLED_PAGES][OLED_WIDTH])
+{
+    memset(frame, 0, OLED_PAGES * OLED_WIDTH);
+    for (int y = 0; y < SSD1306_SIM_ROWS; y++)
+        for (int x = 0; x < OLED_WIDTH; x++)
+            if (ssd1306_sim_get_pixel(sim, x, y))
+                frame[y / 8][x] |= (1 << (y % 8));
+}
+
+
+static esp_err_t ssd1306_sim_transmit(void *ctx, const uint8_t *buffer, size_t size)
+{
+    ssd1306_sim_feed((ssd1306_sim *)ctx, buffer, size);
+    return ESP_OK;
+}
+
+
+/*!
+    @brief  create a transport which drives the simulator.
+    @param  sim
+            simulator state, initialised with ssd1306_sim_init.
+    @return transport to pass to ssd1306_init_oled, NULL if the allocation failed.
+*/
+ssd1306_transport *ssd1306_create_sim_transport(ssd1306_sim *sim)
+{
+    ssd1306_transport *transport = (ssd1306_transport *)malloc(sizeof(ssd1306_transport));
+    if (!transport)
+        return NULL;
+
+    transport->transmit_command = ssd1306_sim_transmit;
+    transport->transmit_data = ssd1306_sim_transmit;
+    transport->transmit_data_async = NULL;
+    transport->ctx = sim;
+    return transport;
+}
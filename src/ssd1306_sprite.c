@@ -0,0 +1,329 @@
+#include "ssd1306_sprite.h"
+#include "esp_log.h"
+#include <stdlib.h>
+#include <string.h>
+
+static const char *TAG = "oled_sprite";                                     // TAG for all the sprite LOGS
+
+
+/*!
+    @brief  create a sprite layer over a view.
+    @param  view
+            oled_buffer pointer the sprites are drawn into.
+    @return layer pointer, NULL if the allocation failed.
+    @note   draw the content of the view first, the sprites keep what is under them.
+*/
+oled_sprite_layer *ssd1306_create_sprite_layer(oled_buffer *view)
+{
+    oled_sprite_layer *layer = (oled_sprite_layer *)malloc(sizeof(oled_sprite_layer));
+    if (!layer) {
+        ESP_LOGE(TAG, "Memory allocation failed for sprite layer.");
+        return NULL;
+    }
+
+    layer->view = view;
+    layer->sprite_count = 0;
+    return layer;
+}
+
+
+/*!
+    @brief  delete the layer and its sprites.
+    @param  layer
+            layer pointer.
+    @return None (Void)
+    @note   the sprites are left drawn in the view, call ssd1306_clear_oled_sprites first to remove them.
+*/
+void ssd1306_delete_sprite_layer(oled_sprite_layer *layer)
+{
+    for (int i = 0; i < layer->sprite_count; i++)
+        ssd1306_delete_viewbox(layer->sprites[i].background);
+    free(layer);
+}
+
+
+/*!
+    @brief  add a sprite on top of the others.
+    @param  layer
+            layer pointer.
+    @param  bitmap
+            page-major bitmap of the sprite ( vertical 1 byte mode ).
+    @param  mask
+            bitmap of the same size, the sprite covers the view where it is lit and the bitmap
+            has to be dark outside it. NULL draws the whole rectangle of the bitmap.
+    @param  width
+            width of the sprite.
+    @param  height
+            height of the sprite.
+    @return sprite pointer, hidden until ssd1306_show_oled_sprite, NULL if no sprite is left or the allocation failed.
+*/
+oled_sprite *ssd1306_add_oled_sprite(oled_sprite_layer *layer, const uint8_t *bitmap, const uint8_t *mask, uint16_t width, uint16_t height)
+{
+    if (layer->sprite_count == OLED_MAX_SPRITES) {
+        ESP_LOGE(TAG, "No free sprite left in the layer.");
+        return NULL;
+    }
+
+    oled_sprite *sprite = &layer->sprites[layer->sprite_count];
+    sprite->background = ssd1306_create_viewbox(width, (height + 7) / 8);
+    if (!sprite->background)
+        return NULL;
+
+    sprite->bitmap = bitmap;
+    sprite->mask = mask;
+    sprite->width = width;
+    sprite->height = height;
+    sprite->x = 0;
+    sprite->y = 0;
+    sprite->visible = 0;
+    sprite->changed = 0;
+    sprite->shown = 0;
+    layer->sprite_count++;
+    return sprite;
+}
+
+
+/*!
+    @brief  move a sprite.
+    @param  sprite
+            sprite pointer.
+    @param  x
+            left column of the sprite in the view, may be outside the view.
+    @param  y
+            top row of the sprite in the view, may be outside the view.
+    @return None (Void)
+    @note   the view changes on the next ssd1306_update_oled_sprites.
+*/
+void ssd1306_move_oled_sprite(oled_sprite *sprite, int16_t x, int16_t y)
+{
+    if (sprite->x == x && sprite->y == y)
+        return;
+
+    sprite->x = x;
+    sprite->y = y;
+    sprite->changed = 1;
+}
+
+
+/*!
+    @brief  show or hide a sprite.
+    @param  sprite
+            sprite pointer.
+    @param  visible
+            '1' to show the sprite and '0' to hide it.
+    @return None (Void)
+    @note   the view changes on the next ssd1306_update_oled_sprites.
+*/
+void ssd1306_show_oled_sprite(oled_sprite *sprite, uint8_t visible)
+{
+    if (sprite->visible == !!visible)
+        return;
+
+    sprite->visible = !!visible;
+    sprite->changed = 1;
+}
+
+
+/*!
+    @brief  change the bitmap of a sprite, e.g. the next frame of a spinner.
+    @param  sprite
+            sprite pointer.
+    @param  bitmap
+            page-major bitmap of the same size as the sprite.
+    @param  mask
+            mask of the same size, NULL for an opaque rectangle.
+    @return None (Void)
+    @note   the view changes on the next ssd1306_update_oled_sprites.
+*/
+void ssd1306_set_oled_sprite_bitmap(oled_sprite *sprite, const uint8_t *bitmap, const uint8_t *mask)
+{
+    sprite->bitmap = bitmap;
+    sprite->mask = mask;
+    sprite->changed = 1;
+}
+
+
+/*!
+    @brief  check if two sprite rectangles overlap.
+    @param  a
+            first sprite.
+    @param  ax
+            column of the first rectangle.
+    @param  ay
+            row of the first rectangle.
+    @param  b
+            second sprite.
+    @param  bx
+            column of the second rectangle.
+    @param  by
+            row of the second rectangle.
+    @return 1 if they overlap, 0 otherwise.
+*/
+static uint8_t ssd1306_oled_sprites_overlap(const oled_sprite *a, int32_t ax, int32_t ay, const oled_sprite *b, int32_t bx, int32_t by)
+{
+    return ax < bx + b->width && bx < ax + a->width && ay < by + b->height && by < ay + a->height;
+}
+
+
+/*!
+    @brief  check if a sprite is touched by the redraw of another one.
+    @param  sprite
+            sprite which might have to be redrawn.
+    @param  other
+            sprite being redrawn.
+    @return 1 if the shown or new rectangle of one meets one of the other, 0 otherwise.
+*/
+static uint8_t ssd1306_oled_sprite_touches(const oled_sprite *sprite, const oled_sprite *other)
+{
+    int32_t x[2] = {sprite->shown_x, sprite->x};
+    int32_t y[2] = {sprite->shown_y, sprite->y};
+    int32_t ox[2] = {other->shown_x, other->x};
+    int32_t oy[2] = {other->shown_y, other->y};
+    uint8_t used[2] = {sprite->shown, sprite->visible};
+    uint8_t other_used[2] = {other->shown, other->visible};
+
+    for (int i = 0; i < 2; i++)
+        for (int j = 0; j < 2; j++)
+            if (used[i] && other_used[j] && ssd1306_oled_sprites_overlap(sprite, x[i], y[i], other, ox[j], oy[j]))
+                return 1;
+    return 0;
+}
+
+
+/*!
+    @brief  put back the view pixels under a drawn sprite.
+    @param  layer
+            layer pointer.
+    @param  sprite
+            sprite pointer.
+    @return None (Void)
+*/
+static void ssd1306_restore_oled_sprite(oled_sprite_layer *layer, oled_sprite *sprite)
+{
+    if (!sprite->shown)
+        return;
+
+    // the background was saved from the part of the sprite inside the view, at the same place.
+    int32_t col = sprite->shown_x > 0 ? sprite->shown_x : 0;
+    int32_t row = sprite->shown_y > 0 ? sprite->shown_y : 0;
+    ssd1306_blit_oled_area(layer->view, col, row, &sprite->background->oled_user_buffer[1], sprite->width,
+                           col - sprite->shown_x, row - sprite->shown_y,
+                           sprite->shown_x + sprite->width - col, sprite->shown_y + sprite->height - row, BLIT_COPY);
+    sprite->shown = 0;
+}
+
+
+/*!
+    @brief  save the view pixels under a sprite and draw it.
+    @param  layer
+            layer pointer.
+    @param  sprite
+            sprite pointer.
+    @return None (Void)
+*/
+static void ssd1306_place_oled_sprite(oled_sprite_layer *layer, oled_sprite *sprite)
+{
+    oled_buffer *view = layer->view;
+    int32_t col = sprite->x > 0 ? sprite->x : 0;
+    int32_t row = sprite->y > 0 ? sprite->y : 0;
+    int32_t col_end = sprite->x + sprite->width < view->width ? sprite->x + sprite->width : view->width;
+    int32_t row_end = sprite->y + sprite->height < view->page * 8 ? sprite->y + sprite->height : view->page * 8;
+
+    sprite->shown_x = sprite->x;
+    sprite->shown_y = sprite->y;
+    if (col >= col_end || row >= row_end)
+        return;                             // nothing of it is in the view.
+
+    ssd1306_blit_oled_area(sprite->background, col - sprite->x, row - sprite->y, &view->oled_user_buffer[1], view->width,
+                           col, row, col_end - col, row_end - row, BLIT_COPY);
+
+    if (sprite->mask)
+    {
+        ssd1306_blit_oled_bitmap(view, sprite->x, sprite->y, sprite->mask, sprite->width, sprite->height, BLIT_AND_NOT);
+        ssd1306_blit_oled_bitmap(view, sprite->x, sprite->y, sprite->bitmap, sprite->width, sprite->height, BLIT_OR);
+    }
+    else
+        ssd1306_blit_oled_bitmap(view, sprite->x, sprite->y, sprite->bitmap, sprite->width, sprite->height, BLIT_COPY);
+    sprite->shown = 1;
+}
+
+
+/*!
+    @brief  bring the view up to date with the sprites.
+    @param  layer
+            layer pointer.
+    @return None (Void)
+    @note   only the sprites which changed are redrawn, together with the ones stacked over or under them
+            that they overlap. their old rectangles get back the saved background and the new ones the sprite,
+            so just those rectangles are marked dirty for the next flush. all the changes reach the screen at once.
+*/
+void ssd1306_update_oled_sprites(oled_sprite_layer *layer)
+{
+    uint8_t redraw[OLED_MAX_SPRITES];
+    uint8_t any = 0;
+
+    for (int i = 0; i < layer->sprite_count; i++)
+    {
+        redraw[i] = layer->sprites[i].changed;
+        any |= redraw[i];
+    }
+    if (!any)
+        return;
+
+    // a sprite meeting a redrawn one is redrawn too, so restoring never wipes a sprite still drawn.
+    uint8_t grown = 1;
+    while (grown)
+    {
+        grown = 0;
+        for (int i = 0; i < layer->sprite_count; i++)
+        {
+            if (redraw[i])
+                continue;
+            for (int j = 0; j < layer->sprite_count; j++)
+            {
+                if (redraw[j] && ssd1306_oled_sprite_touches(&layer->sprites[i], &layer->sprites[j]))
+                {
+                    redraw[i] = 1;
+                    grown = 1;
+                    break;
+                }
+            }
+        }
+    }
+
+    ssd1306_begin_oled_draw(layer->view);
+    for (int i = layer->sprite_count - 1; i >= 0; i--)
+        if (redraw[i])
+            ssd1306_restore_oled_sprite(layer, &layer->sprites[i]);
+
+    for (int i = 0; i < layer->sprite_count; i++)
+    {
+        oled_sprite *sprite = &layer->sprites[i];
+        if (redraw[i] && sprite->visible)
+            ssd1306_place_oled_sprite(layer, sprite);
+        sprite->changed = 0;
+    }
+    ssd1306_end_oled_draw(layer->view);
+}
+
+
+/*!
+    @brief  take every sprite out of the view, leaving the background.
+    @param  layer
+            layer pointer.
+    @return None (Void)
+    @note   call it before drawing the background again, the next ssd1306_update_oled_sprites puts the visible
+            sprites back over the new background.
+*/
+void ssd1306_clear_oled_sprites(oled_sprite_layer *layer)
+{
+    ssd1306_begin_oled_draw(layer->view);
+    for (int i = layer->sprite_count - 1; i >= 0; i--)
+    {
+        oled_sprite *sprite = &layer->sprites[i];
+        ssd1306_restore_oled_sprite(layer, sprite);
+        if (sprite->visible)
+            sprite->changed = 1;
+    }
+    ssd1306_end_oled_draw(layer->view);
+}
@@ -0,0 +1,253 @@
+#include "ssd1306_text.h"
+#include "esp_log.h"
+#include <stdlib.h>
+#include <string.h>
+
+static const char *TAG = "oled_text";                                       // TAG for all the text LOGS
+
+
+/*!
+    @brief  end of the UTF-8 character starting at a position.
+    @param  string
+            UTF-8 string.
+    @param  pos
+            first byte of the character.
+    @return position of the next character.
+*/
+static uint16_t ssd1306_next_text_char(const char *string, uint16_t pos)
+{
+    pos++;
+    while ((string[pos] & 0xC0) == 0x80)
+        pos++;
+    return pos;
+}
+
+
+/*!
+    @brief  break the string of the layout into lines.
+    @param  layout
+            layout pointer, its string, font and box are used.
+    @param  lines
+            filled with the lines, NULL to only count them.
+    @return number of lines that fit in the box.
+    @note   lines break after the last word that fits, at a '\n', or inside a word wider than the box.
+            spaces at the break of a wrapped line are dropped, a line that would not fully fit
+            under the box is dropped with all the text after it and sets truncated.
+*/
+static uint16_t ssd1306_wrap_text_layout(text_layout *layout, text_line *lines)
+{
+    const char *string = layout->string;
+    int line_height = layout->font->height + OLED_TEXT_LINE_SPACING;
+    int y = layout->y;
+    uint16_t count = 0;
+    uint16_t pos = 0;
+    uint8_t wrapped = 0;
+
+    layout->truncated = 0;
+    layout->text_width = 0;
+    layout->text_height = 0;
+
+    while (string[pos])
+    {
+        if (wrapped)
+        {
+            while (string[pos] == ' ')
+                pos++;
+            if (!string[pos])
+                break;
+        }
+
+        if (y + layout->font->height > layout->y + layout->height)
+        {
+            layout->truncated = 1;
+            break;
+        }
+
+        uint16_t start = pos;
+        uint16_t scan = pos;
+        uint16_t next;
+        wrapped = 0;
+
+        while (1)
+        {
+            if (string[scan] == '\n' || string[scan] == '\0')
+            {
+                next = string[scan] ? scan + 1 : scan;
+                break;
+            }
+
+            // the spaces before the next word go with it, spaces ending the line are ignored.
+            uint16_t word_end = scan;
+            while (string[word_end] == ' ')
+                word_end++;
+            if (string[word_end] == '\n' || string[word_end] == '\0')
+            {
+                scan = word_end;
+                continue;
+            }
+            while (string[word_end] && string[word_end] != ' ' && string[word_end] != '\n')
+                word_end++;
+
+            if (ssd1306_measure_oled_string(layout->font, string + start, word_end - start) <= layout->width)
+            {
+                scan = word_end;
+                continue;
+            }
+
+            if (scan == start)
+            {
+                // a word wider than the box is cut after its last character that fits ( at least one ).
+                scan = ssd1306_next_text_char(string, start);
+                while (scan < word_end)
+                {
+                    uint16_t after = ssd1306_next_text_char(string, scan);
+                    if (ssd1306_measure_oled_string(layout->font, string + start, after - start) > layout->width)
+                        break;
+                    scan = after;
+                }
+            }
+            next = scan;
+            wrapped = 1;
+            break;
+        }
+
+        uint16_t end = scan;
+        while (end > start && string[end - 1] == ' ')
+            end--;
+
+        uint16_t width = ssd1306_measure_oled_string(layout->font, string + start, end - start);
+        if (width > layout->text_width)
+            layout->text_width = width;
+
+        if (lines)
+        {
+            text_line *line = &lines[count];
+            line->start = start;
+            line->length = end - start;
+            line->y = y;
+            if (layout->align == TEXT_ALIGN_CENTER)
+                line->x = layout->x + ((int)layout->width - width) / 2;
+            else if (layout->align == TEXT_ALIGN_RIGHT)
+                line->x = layout->x + (int)layout->width - width;
+            else
+                line->x = layout->x;
+        }
+
+        count++;
+        layout->text_height = y + layout->font->height - layout->y;
+        y += line_height;
+        pos = next;
+    }
+
+    return count;
+}
+
+
+/*!
+    @brief  lay a string out in a box of a view.
+    @param  string
+            UTF-8 string, only referenced so keep it alive as long as the layout.
+    @param  font_pack
+            font_pack struct pointer.
+    @param  x
+            left column of the box in the view.
+    @param  y
+            top row of the box in the view.
+    @param  width
+            width of the box, lines wrap to it.
+    @param  height
+            height of the box, lines that don't fit under it are dropped.
+    @param  align
+            TEXT_ALIGN_LEFT, TEXT_ALIGN_CENTER or TEXT_ALIGN_RIGHT.
+    @return layout pointer, NULL if the allocation failed.
+    @note   the layout is computed once, drawing it with ssd1306_draw_text_layout only blits the lines.
+*/
+text_layout *ssd1306_create_text_layout(const char *string, font_pack *font_pack, int16_t x, int16_t y, uint16_t width, uint16_t height, text_align align)
+{
+    text_layout *layout = (text_layout *)malloc(sizeof(text_layout));
+    if (!layout) {
+        ESP_LOGE(TAG, "Memory allocation failed for text layout.");
+        return NULL;
+    }
+
+    layout->font = font_pack;
+    layout->x = x;
+    layout->y = y;
+    layout->width = width;
+    layout->height = height;
+    layout->align = align;
+    layout->line_count = 0;
+    layout->lines = NULL;
+
+    if (ssd1306_update_text_layout(layout, string) != ESP_OK) {
+        free(layout);
+        return NULL;
+    }
+    return layout;
+}
+
+
+/*!
+    @brief  delete the layout and its lines.
+    @param  layout
+            layout pointer.
+    @return None (Void)
+    @note   the string of the layout is not freed.
+*/
+void ssd1306_delete_text_layout(text_layout *layout)
+{
+    free(layout->lines);
+    free(layout);
+}
+
+
+/*!
+    @brief  lay a new string out in the box of the layout.
+    @param  layout
+            layout pointer.
+    @param  string
+            UTF-8 string, only referenced so keep it alive as long as the layout.
+    @return ESP_OK or ESP_ERR_NO_MEM if the lines couldn't be allocated ( the layout is then empty ).
+*/
+esp_err_t ssd1306_update_text_layout(text_layout *layout, const char *string)
+{
+    layout->string = string;
+    uint16_t count = ssd1306_wrap_text_layout(layout, NULL);
+
+    if (count > layout->line_count || !layout->lines)
+    {
+        text_line *lines = (text_line *)realloc(layout->lines, (count ? count : 1) * sizeof(text_line));
+        if (!lines) {
+            ESP_LOGE(TAG, "Memory allocation failed for text layout lines.");
+            layout->line_count = 0;
+            return ESP_ERR_NO_MEM;
+        }
+        layout->lines = lines;
+    }
+
+    layout->line_count = ssd1306_wrap_text_layout(layout, layout->lines);
+    return ESP_OK;
+}
+
+
+/*!
+    @brief  draw the lines of a layout into a view.
+    @param  oled_user_buffer
+            oled_buffer type pointer
+    @param  layout
+            layout pointer.
+    @return None (Void)
+    @note   glyphs are clipped to the box of the layout and to the view, a line partly above the view keeps
+            its lower rows. all the lines reach the screen at once.
+*/
+void ssd1306_draw_text_layout(oled_buffer *oled_user_buffer, const text_layout *layout)
+{
+    ssd1306_begin_oled_draw(oled_user_buffer);
+    for (uint16_t i = 0; i < layout->line_count; i++)
+    {
+        const text_line *line = &layout->lines[i];
+        ssd1306_draw_oled_text(oled_user_buffer, line->x, layout->string + line->start, line->length, layout->font, line->y,
+                               layout->x, layout->x + layout->width - 1);
+    }
+    ssd1306_end_oled_draw(oled_user_buffer);
+}
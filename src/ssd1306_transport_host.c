@@ -0,0 +1,104 @@
+#include "ssd1306_transport.h"
+#include <stdlib.h>
+#include <string.h>
+
+
+/*!
+    @brief  record a transaction on the in-memory bus.
+    @param  ctx
+            ssd1306_host_bus pointer.
+    @param  buffer
+            buffer starting with its control byte.
+    @param  size
+            size of the buffer.
+    @return ESP_OK.
+*/
+static esp_err_t ssd1306_host_transmit(void *ctx, const uint8_t *buffer, size_t size)
+{
+    ssd1306_host_bus *bus = (ssd1306_host_bus *)ctx;
+
+    if (size > 0 && buffer[0] == 0x40)
+    {
+        bus->data_transactions++;
+        bus->data_bytes += size;
+    }
+    else
+    {
+        bus->command_transactions++;
+        bus->command_bytes += size;
+    }
+
+    if (bus->capture && bus->capture_size < bus->capture_capacity)
+    {
+        size_t room = bus->capture_capacity - bus->capture_size;
+        size_t count = size < room ? size : room;
+        memcpy(&bus->capture[bus->capture_size], buffer, count);
+        bus->capture_size += count;
+    }
+
+    if (bus->sink)
+        bus->sink(bus->sink_arg, buffer, size);
+
+    return ESP_OK;
+}
+
+
+/*!
+    @brief  record a transaction on the in-memory bus and report it as finished.
+    @param  ctx
+            ssd1306_host_bus pointer.
+    @param  buffer
+            buffer starting with its control byte.
+    @param  size
+            size of the buffer.
+    @param  done
+            completion callback.
+    @param  user_arg
+            argument for the completion callback.
+    @return ESP_OK.
+    @note   the in-memory bus is instantaneous, so the transfer completes before this returns.
+*/
+static esp_err_t ssd1306_host_transmit_async(void *ctx, const uint8_t *buffer, size_t size, ssd1306_transfer_done_cb done, void *user_arg)
+{
+    esp_err_t err = ssd1306_host_transmit(ctx, buffer, size);
+    if (done)
+        done(user_arg);
+    return err;
+}
+
+
+/*!
+    @brief  create a transport which keeps the traffic in memory instead of sending it to a panel.
+    @param  bus
+            in-memory bus owned by the caller, its counters and capture are updated on every transfer.
+    @return transport to pass to ssd1306_init_oled, NULL if the allocation failed.
+    @note   used to run the driver on a host (Linux) machine, e.g. to measure bytes on the wire in CI.
+*/
+ssd1306_transport *ssd1306_create_host_transport(ssd1306_host_bus *bus)
+{
+    ssd1306_transport *transport = (ssd1306_transport *)malloc(sizeof(ssd1306_transport));
+    if (!transport)
+        return NULL;
+
+    transport->transmit_command = ssd1306_host_transmit;
+    transport->transmit_data = ssd1306_host_transmit;
+    transport->transmit_data_async = ssd1306_host_transmit_async;
+    transport->ctx = bus;
+    return transport;
+}
+
+
+/*!
+    @brief  reset the counters and the capture of the in-memory bus.
+    @param  bus
+            in-memory bus.
+    @return None (Void)
+*/
+void ssd1306_reset_host_bus(ssd1306_host_bus *bus)
+{
+    bus->command_transactions = 0;
+    bus->data_transactions = 0;
+    bus->command_bytes = 0;
+    bus->data_bytes = 0;
+    bus->capture_size = 0;
+}
@@ -0,0 +1,169 @@
+#include "ssd1306_oled.h"
+#include "ssd1306_transport.h"
+#include "freertos/FreeRTOS.h"
+#include "driver/i2c_master.h"
+#include "esp_err.h"
+#include "esp_log.h"
+
+static const char *TAG = "oled_i2c";                                        // TAG for all the I2C transport LOGS
+
+static i2c_master_dev_handle_t oled_handle;                                 // I2C handle for OLED
+static i2c_master_bus_handle_t oled_master_handle;                          // I2C handle for Master Bus
+
+static ssd1306_transport oled_i2c_transport;                                // Transport handed to the driver
+
+static volatile uint32_t oled_submitted_transfers = 0;                      // Transfers queued on the bus so far
+static volatile uint32_t oled_completed_transfers = 0;                      // Transfers finished so far
+static volatile uint32_t oled_async_transfer = 0;                           // Number of the pending async transfer ( 0 for none )
+static ssd1306_transfer_done_cb oled_async_done = NULL;                     // Completion callback of the pending async transfer
+static void *oled_async_done_arg = NULL;
+
+
+/*!
+    @brief  send a buffer to the OLED over I2C.
+    @param  ctx
+            unused, the I2C handles are static.
+    @param  buffer
+            buffer starting with its control byte.
+    @param  size
+            size of the buffer.
+    @return ESP_OK on success.
+*/
+static esp_err_t ssd1306_i2c_transmit(void *ctx, const uint8_t *buffer, size_t size)
+{
+#if I2C_TRANS_QUEUE_DEPTH > 0
+    // with a transaction queue every transmit is asynchronous, so wait for it ( and any async one before it ).
+    oled_submitted_transfers++;
+    esp_err_t err = i2c_master_transmit(oled_handle, buffer, size, XFER_TIMEOUT_MS);
+    if (err != ESP_OK)
+        return err;
+    return i2c_master_bus_wait_all_done(oled_master_handle, XFER_TIMEOUT_MS);
+#else
+    return i2c_master_transmit(oled_handle, buffer, size, XFER_TIMEOUT_MS);
+#endif
+}
+
+
+#if I2C_TRANS_QUEUE_DEPTH > 0
+/*!
+    @brief  I2C transaction done interrupt, finishes the pending async transfer once it is reached.
+    @param  dev
+            OLED device handle.
+    @param  event
+            transaction event.
+    @param  user_data
+            unused.
+    @return true if the completion callback woke a higher priority task, the I2C driver yields then.
+*/
+static bool ssd1306_i2c_transfer_done_isr(i2c_master_dev_handle_t dev, const i2c_master_event_data_t *event, void *user_data)
+{
+    bool task_woken = false;
+
+    oled_completed_transfers++;
+    if (oled_async_transfer != 0 && oled_completed_transfers == oled_async_transfer)
+    {
+        oled_async_transfer = 0;
+        if (oled_async_done)
+            task_woken = oled_async_done(oled_async_done_arg);
+    }
+    return task_woken;
+}
+
+
+/*!
+    @brief  queue a buffer on the I2C bus and return without waiting.
+    @param  ctx
+            unused, the I2C handles are static.
+    @param  buffer
+            buffer starting with its control byte, it must stay untouched until done is called.
+    @param  size
+            size of the buffer.
+    @param  done
+            called from the I2C interrupt when the buffer is sent.
+    @param  user_arg
+            argument for done.
+    @return ESP_OK on success.
+    @note   only one async transfer can be pending, the driver waits for it before the next one.
+*/
+static esp_err_t ssd1306_i2c_transmit_async(void *ctx, const uint8_t *buffer, size_t size, ssd1306_transfer_done_cb done, void *user_arg)
+{
+    oled_async_done = done;
+    oled_async_done_arg = user_arg;
+    oled_async_transfer = ++oled_submitted_transfers;
+    return i2c_master_transmit(oled_handle, buffer, size, XFER_TIMEOUT_MS);
+}
+#endif
+
+
+/*!
+    @brief  create the I2C bus and the OLED device on it.
+    @param  i2c_address
+            I2C address of The OLED which is the 0x3C (in hex) in most of the Cases
+    @param  sda_gpio_pin
+            I2C SDA pin number which is connected to the OLED (it is the data pin).
+    @param  scl_gpio_pin
+            I2C SCL pin number which is connetec to the OLED (it is the clock pin).
+    @return transport to pass to ssd1306_init_oled.
+    @note   the OLED is probed once here, later transfers go straight to the device.
+*/
+ssd1306_transport *ssd1306_create_i2c_transport(uint8_t i2c_address, uint8_t sda_gpio_pin, uint8_t scl_gpio_pin)
+{
+    // Creating the I2C Master config structure
+    i2c_master_bus_config_t i2c_mst_config = {
+        .i2c_port = I2C_PORT,
+        .scl_io_num = scl_gpio_pin,
+        .sda_io_num = sda_gpio_pin,
+        .clk_source = I2C_CLK_SRC_DEFAULT,
+        .glitch_ignore_cnt = GLITCH_IGNORE_CNT,
+        .trans_queue_depth = I2C_TRANS_QUEUE_DEPTH,
+        .flags.enable_internal_pullup = ENABLE_INPERRUPT_PULLUP};
+
+    // Adding the Master config to the Master handle
+    ESP_ERROR_CHECK(i2c_new_master_bus(&i2c_mst_config, &oled_master_handle));
+    ESP_LOGI(TAG, "Master Bus is created.");
+
+    // Creating the I2C device config structure ( which is the OLED here )
+    i2c_device_config_t oled_cfg = {
+        .dev_addr_length = I2C_ADDR_BIT_LEN_7,
+        .device_address = i2c_address,
+        .scl_speed_hz = I2C_SCL_SPEED,
+    };
+
+    // Adding the slave ( OLED ) config and handler to the master handler.
+    ESP_ERROR_CHECK(i2c_master_bus_add_device(oled_master_handle, &oled_cfg, &oled_handle));
+    ESP_LOGI(TAG, "Master Bus Device is added.");
+
+    // probing the OLED once, every later transfer goes straight to the device.
+    ESP_ERROR_CHECK(i2c_master_probe(oled_master_handle, i2c_address, XFER_TIMEOUT_MS));
+
+    oled_i2c_transport.transmit_command = ssd1306_i2c_transmit;
+    oled_i2c_transport.transmit_data = ssd1306_i2c_transmit;
+#if I2C_TRANS_QUEUE_DEPTH > 0
+    i2c_master_event_callbacks_t callbacks = {
+        .on_trans_done = ssd1306_i2c_transfer_done_isr,
+    };
+    ESP_ERROR_CHECK(i2c_master_register_event_callbacks(oled_handle, &callbacks, NULL));
+    oled_i2c_transport.transmit_data_async = ssd1306_i2c_transmit_async;
+#else
+    oled_i2c_transport.transmit_data_async = NULL;
+#endif
+    oled_i2c_transport.ctx = NULL;
+    return &oled_i2c_transport;
+}
+
+
+/*!
+    @brief  Initalised the OLED over the I2C protocol
+    @param  i2c_address
+            I2C address of The OLED which is the 0x3C (in hex) in most of the Cases
+    @param  sda_gpio_pin
+            I2C SDA pin number which is connected to the OLED (it is the data pin).
+    @param  scl_gpio_pin
+            I2C SCL pin number which is connetec to the OLED (it is the clock pin).
+    @return None (Void)
+    @note   shortcut for ssd1306_init_oled(ssd1306_create_i2c_transport(...)).
+*/
+void ssd1306_init_oled_i2c(uint8_t i2c_address, uint8_t sda_gpio_pin, uint8_t scl_gpio_pin)
+{
+    ssd1306_init_oled(ssd1306_create_i2c_transport(i2c_address, sda_gpio_pin, scl_gpio_pin));
+}
@@ -0,0 +1,112 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "ssd1306_oled.h"
+
+// Host test of the clipped bit-blit against a per-pixel reference: random areas of random bitmaps
+// land with every raster op on random views, at offsets left of, above, inside and past the view, so
+// most of them are partly off the view. only the pixels under the area may change.
+
+#define BLIT_TEST_ROUNDS            4000
+#define BLIT_TEST_MAX_SIZE          48
+
+static const char *blit_op_names[5] = {"BLIT_COPY", "BLIT_OR", "BLIT_AND", "BLIT_XOR", "BLIT_AND_NOT"};
+
+
+/*!
+    @brief  read a pixel of a page-major bitmap, 0 based.
+    @return 1 when lit, 0 otherwise.
+*/
+static int blit_test_pixel(const uint8_t *pixels, int width, int x, int y)
+{
+    return (pixels[((y / 8) * width) + x] >> (y % 8)) & 1;
+}
+
+
+/*!
+    @brief  reference raster op on one pixel.
+    @return the new view pixel.
+*/
+static int blit_test_op(blit_op op, int view, int bitmap)
+{
+    switch (op)
+    {
+    case BLIT_COPY: return bitmap;
+    case BLIT_OR: return view | bitmap;
+    case BLIT_AND: return view & bitmap;
+    case BLIT_XOR: return view ^ bitmap;
+    default: return view & !bitmap;
+    }
+}
+
+
+int main(void)
+{
+    static uint8_t before[OLED_WIDTH * OLED_PAGES];
+    srand(1);
+
+    for (int round = 0; round < BLIT_TEST_ROUNDS; round++)
+    {
+        int view_width = 1 + (rand() % OLED_WIDTH);
+        int view_pages = 1 + (rand() % OLED_PAGES);
+        int view_height = view_pages * 8;
+        int bitmap_width = 1 + (rand() % BLIT_TEST_MAX_SIZE);
+        int bitmap_height = 1 + (rand() % BLIT_TEST_MAX_SIZE);
+        blit_op op = (blit_op)(rand() % 5);
+
+        // an area inside the bitmap, empty ones ( width or height <= 0 ) included.
+        int src_x = rand() % bitmap_width, src_y = rand() % bitmap_height;
+        int width = (rand() % (bitmap_width - src_x + 2)) - 1;
+        int height = (rand() % (bitmap_height - src_y + 2)) - 1;
+        int whole = round % 4 == 0;
+        if (whole)
+        {
+            src_x = src_y = 0;
+            width = bitmap_width;
+            height = bitmap_height;
+        }
+        int x = (rand() % (view_width + (2 * BLIT_TEST_MAX_SIZE))) - BLIT_TEST_MAX_SIZE;
+        int y = (rand() % (view_height + (2 * BLIT_TEST_MAX_SIZE))) - BLIT_TEST_MAX_SIZE;
+
+        uint8_t *bitmap = malloc(bitmap_width * ((bitmap_height + 7) / 8));
+        for (int i = 0; i < bitmap_width * ((bitmap_height + 7) / 8); i++)
+            bitmap[i] = rand();
+
+        oled_buffer *view = ssd1306_create_viewbox(view_width, view_pages);
+        for (uint32_t i = 1; i < view->oled_user_buffer_size; i++)
+            view->oled_user_buffer[i] = rand();
+        memcpy(before, &view->oled_user_buffer[1], view->oled_user_buffer_size - 1);
+
+        if (whole)
+            ssd1306_blit_oled_bitmap(view, x, y, bitmap, bitmap_width, bitmap_height, op);
+        else
+            ssd1306_blit_oled_area(view, x, y, bitmap, bitmap_width, src_x, src_y, width, height, op);
+
+        for (int vy = 0; vy < view_height; vy++)
+            for (int vx = 0; vx < view_width; vx++)
+            {
+                int expected = blit_test_pixel(before, view_width, vx, vy);
+                if (vx - x >= 0 && vx - x < width && vy - y >= 0 && vy - y < height)
+                    expected = blit_test_op(op, expected, blit_test_pixel(bitmap, bitmap_width, src_x + vx - x, src_y + vy - y));
+
+                if (blit_test_pixel(&view->oled_user_buffer[1], view_width, vx, vy) != expected)
+                {
+                    printf("FAIL: %s of %d x %d at %d, %d of a %d x %d bitmap to %d, %d in a %d x %d view, pixel %d, %d\n",
+                           blit_op_names[op], width, height, src_x, src_y, bitmap_width, bitmap_height,
+                           x, y, view_width, view_height, vx, vy);
+                    return 1;
+                }
+            }
+        if (view->oled_user_buffer[0] != 0x40)
+        {
+            printf("FAIL: control byte overwritten\n");
+            return 1;
+        }
+
+        ssd1306_delete_viewbox(view);
+        free(bitmap);
+    }
+
+    printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,147 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "ssd1306_bitmap_codec.h"
+
+// Host test of the packed bitmap format: random and edge-case bitmaps ( blank, full, runs around the
+// token limits, repeats right at and just past the OLED_PACKED_WINDOW byte window ) are packed and
+// unpacked again, whole and clipped at random offsets, and every copy token has to stay in the window.
+// a truncated packed bitmap has to be refused.
+
+#define CODEC_TEST_ROUNDS           600
+#define CODEC_TEST_MAX_WIDTH        300
+#define CODEC_TEST_MAX_PAGES        8
+#define CODEC_TEST_KINDS            8
+
+static uint8_t bitmap[CODEC_TEST_MAX_WIDTH * CODEC_TEST_MAX_PAGES];
+static uint8_t packed[(CODEC_TEST_MAX_WIDTH * CODEC_TEST_MAX_PAGES * 2) + OLED_PACKED_HEADER];
+static uint8_t unpacked[CODEC_TEST_MAX_WIDTH * CODEC_TEST_MAX_PAGES];
+static uint8_t screen[16 * 16];
+static uint8_t reference[16 * 16];
+
+
+/*!
+    @brief  fill the bitmap with one kind of content.
+    @param  kind
+            0 random, 1 blank, 2 full, 3 random runs, 4 a pattern repeating every window bytes,
+            5 every window + 1 bytes, 6 sparse pixels, 7 runs right around the token limits.
+    @param  total
+            bytes of the bitmap.
+    @return None (Void)
+*/
+static void codec_test_fill(int kind, uint32_t total)
+{
+    for (uint32_t i = 0; i < total; i++)
+    {
+        switch (kind)
+        {
+        case 0: bitmap[i] = rand(); break;
+        case 1: bitmap[i] = 0x00; break;
+        case 2: bitmap[i] = 0xFF; break;
+        case 3: bitmap[i] = (i == 0 || rand() % 40 == 0) ? rand() : bitmap[i - 1]; break;
+        case 4: bitmap[i] = i < OLED_PACKED_WINDOW ? rand() : bitmap[i - OLED_PACKED_WINDOW]; break;
+        case 5: bitmap[i] = i < OLED_PACKED_WINDOW + 1 ? rand() : bitmap[i - OLED_PACKED_WINDOW - 1]; break;
+        case 6: bitmap[i] = rand() % 16 == 0 ? 1 << (rand() % 8) : 0x00; break;
+        default:
+        {
+            // runs of 63 - 67 equal bytes, zero ones included, around the 64 / 65 / 66 byte token limits.
+            static const uint8_t values[3] = {0x00, 0xFF, 0x5A};
+            static uint32_t left = 0;
+            static uint8_t value = 0;
+            if (i == 0 || left == 0)
+            {
+                left = 63 + (rand() % 5);
+                value = values[rand() % 3];
+            }
+            bitmap[i] = value;
+            left--;
+            break;
+        }
+        }
+    }
+}
+
+
+/*!
+    @brief  check that every copy token of a packed bitmap reaches back at most the window.
+    @return 1 when they do, 0 otherwise.
+*/
+static int codec_test_window(size_t size)
+{
+    size_t in = OLED_PACKED_HEADER;
+    while (in < size)
+    {
+        uint8_t token = packed[in++];
+        uint32_t count = token & 0x3F;
+        switch (token & 0xC0)
+        {
+        case OLED_PACKED_ZERO: break;
+        case OLED_PACKED_FILL: in++; break;
+        case OLED_PACKED_LITERAL: in += count + 1; break;
+        default:
+            if ((uint32_t)packed[in] + 1 > OLED_PACKED_WINDOW)
+                return 0;
+            in++;
+            break;
+        }
+    }
+    return 1;
+}
+
+
+int main(void)
+{
+    srand(1);
+
+    for (int round = 0; round < CODEC_TEST_ROUNDS; round++)
+    {
+        int kind = round % CODEC_TEST_KINDS;
+        uint16_t width = 1 + (rand() % CODEC_TEST_MAX_WIDTH);
+        uint8_t pages = 1 + (rand() % CODEC_TEST_MAX_PAGES);
+        if (round < CODEC_TEST_KINDS)
+            width = 1, pages = 1;           // the smallest bitmap of every kind.
+        uint32_t total = (uint32_t)width * pages;
+        codec_test_fill(kind, total);
+
+        size_t size = ssd1306_pack_oled_bitmap(bitmap, width, pages, packed, sizeof(packed));
+        if (size == 0 || !codec_test_window(size))
+        {
+            printf("FAIL: kind %d, %u x %u bitmap packed to %u bytes\n", kind, width, pages, (unsigned)size);
+            return 1;
+        }
+
+        memset(unpacked, 0xA5, sizeof(unpacked));
+        if (ssd1306_unpack_oled_bitmap(packed, size, unpacked, width, pages, 0, 0) != 0 ||
+            memcmp(unpacked, bitmap, total) != 0)
+        {
+            printf("FAIL: kind %d, %u x %u bitmap doesn't unpack to itself\n", kind, width, pages);
+            return 1;
+        }
+
+        if (size > OLED_PACKED_HEADER && ssd1306_unpack_oled_bitmap(packed, size - 1, unpacked, width, pages, 0, 0) == 0)
+        {
+            printf("FAIL: kind %d, %u x %u bitmap unpacks with its last byte missing\n", kind, width, pages);
+            return 1;
+        }
+
+        // clipped into a small destination, partly or fully off it.
+        int32_t col = (rand() % (width + 32)) - width;
+        int32_t page = (rand() % (pages + 16)) - pages;
+        memset(screen, 0x3C, sizeof(screen));
+        memset(reference, 0x3C, sizeof(reference));
+        for (int32_t p = 0; p < pages; p++)
+            for (int32_t x = 0; x < width; x++)
+                if (col + x >= 0 && col + x < 16 && page + p >= 0 && page + p < 16)
+                    reference[((page + p) * 16) + col + x] = bitmap[(p * width) + x];
+
+        if (ssd1306_unpack_oled_bitmap(packed, size, screen, 16, 16, col, page) != 0 ||
+            memcmp(screen, reference, sizeof(screen)) != 0)
+        {
+            printf("FAIL: kind %d, %u x %u bitmap unpacked at %d, %d\n", kind, width, pages, col, page);
+            return 1;
+        }
+    }
+
+    printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,215 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "ssd1306_oled.h"
+#include "ssd1306_sim.h"
+#include "ssd1306_bitmap_codec.h"
+#include "ssd1306_animation.h"
+
+// Host test of the frame deltas: random frame pairs ( small and wide changes, runs past the 128 byte
+// token limit, equal frames, a blank previous frame ) are packed and applied again, whole and clipped
+// at random offsets, and the changed box has to be the box of the changed bytes. a packed animation has
+// to walk through its frames and back to frame 0, and the player has to show them on the simulated
+// screen sending fewer bytes than full flushes.
+
+#define DELTA_TEST_ROUNDS           800
+#define DELTA_TEST_MAX_WIDTH        128
+#define DELTA_TEST_MAX_PAGES        8
+#define DELTA_TEST_FRAMES           12
+
+static uint8_t previous[DELTA_TEST_MAX_WIDTH * DELTA_TEST_MAX_PAGES];
+static uint8_t frame[DELTA_TEST_MAX_WIDTH * DELTA_TEST_MAX_PAGES];
+static uint8_t applied[DELTA_TEST_MAX_WIDTH * DELTA_TEST_MAX_PAGES];
+static uint8_t delta[(DELTA_TEST_MAX_WIDTH * DELTA_TEST_MAX_PAGES * 2) + 16];
+static uint8_t frames[DELTA_TEST_FRAMES][40 * 3];
+static uint8_t animation[sizeof(frames) * 2];
+static uint8_t screen[16 * 16];
+static uint8_t reference[16 * 16];
+
+
+/*!
+    @brief  change some bytes of the previous frame into the next one.
+    @param  kind
+            0 a few bytes, 1 about half of them, 2 one long run, 3 none, 4 all of them.
+    @param  total
+            bytes of a frame.
+    @return None (Void)
+*/
+static void delta_test_change(int kind, uint32_t total)
+{
+    memcpy(frame, previous, total);
+    uint32_t start = rand() % total, length = 1 + (rand() % total);
+
+    for (uint32_t i = 0; i < total; i++)
+    {
+        int change = 0;
+        switch (kind)
+        {
+        case 0: change = rand() % 50 == 0; break;
+        case 1: change = rand() % 2; break;
+        case 2: change = i >= start && i - start < length; break;
+        case 3: change = 0; break;
+        default: change = 1; break;
+        }
+        if (change)
+            frame[i] ^= 1 + (rand() % 255);
+    }
+}
+
+
+/*!
+    @brief  play a packed animation by hand and check every frame it brings.
+    @param  size
+            bytes of the packed animation.
+    @param  length
+            bytes of a frame.
+    @return 1 when every delta leads to its frame, 0 otherwise.
+*/
+static int delta_test_walk(size_t size, uint32_t length)
+{
+    size_t offset = OLED_ANIMATION_HEADER;
+    memset(applied, 0x00, length);
+
+    for (uint32_t d = 0; d <= DELTA_TEST_FRAMES; d++)
+    {
+        if (offset + 2 > size)
+            return 0;
+        uint16_t bytes = animation[offset] | (animation[offset + 1] << 8);
+        if (ssd1306_apply_oled_delta(&animation[offset + 2], bytes, 40, 3, applied, 40, 3, 0, 0, NULL) != 0)
+            return 0;
+        if (memcmp(applied, frames[d % DELTA_TEST_FRAMES], length) != 0)
+            return 0;               // the last delta brings back frame 0.
+        offset += 2 + bytes;
+    }
+    return offset == size;
+}
+
+
+/*!
+    @brief  play the animation with the player on the simulated screen.
+    @param  size
+            bytes of the packed animation.
+    @return 1 when the screen shows every frame and the flushes sent less than the view, 0 otherwise.
+*/
+static int delta_test_player(size_t size)
+{
+    static ssd1306_sim sim;
+    ssd1306_sim_init(&sim);
+    ssd1306_transport *transport = ssd1306_create_sim_transport(&sim);
+    ssd1306_init_oled(transport);
+    ssd1306_oled_clear(0);
+
+    oled_buffer *view = ssd1306_create_viewbox(128, 8);
+    ssd1306_send_oled_display_buffer(view);
+    oled_animation *player = ssd1306_create_oled_animation(view, animation, size, 20, 2, 1000);
+    int ok = player != NULL && view->flush_mode == FLUSH_DIRTY;
+    ssd1306_sim_reset_counters(&sim);
+
+    for (uint32_t step = 0; ok && step < 2 * DELTA_TEST_FRAMES; step++)
+    {
+        ok = ssd1306_step_oled_animation(player) == ESP_OK;
+        ssd1306_send_oled_display_buffer(view);
+        for (int page = 0; ok && page < 3; page++)
+            ok = memcmp(&sim.gddram[2 + page][20], &frames[step % DELTA_TEST_FRAMES][page * 40], 40) == 0;
+    }
+    if (ok && sim.data_bytes >= 2 * DELTA_TEST_FRAMES * 128 * 8)
+        ok = 0;
+
+    if (player)
+        ssd1306_delete_oled_animation(player);
+    ssd1306_delete_viewbox(view);
+    free(transport);
+    return ok;
+}
+
+
+int main(void)
+{
+    srand(1);
+
+    for (int round = 0; round < DELTA_TEST_ROUNDS; round++)
+    {
+        int kind = round % 5;
+        uint16_t width = 1 + (rand() % DELTA_TEST_MAX_WIDTH);
+        uint8_t pages = 1 + (rand() % DELTA_TEST_MAX_PAGES);
+        uint32_t total = (uint32_t)width * pages;
+        int blank = round % 7 == 0;
+
+        for (uint32_t i = 0; i < total; i++)
+            previous[i] = blank ? 0x00 : rand();
+        delta_test_change(kind, total);
+
+        size_t size = ssd1306_pack_oled_delta(blank ? NULL : previous, frame, total, delta, sizeof(delta));
+        if (size == SIZE_MAX || (kind == 3 && size != 0))
+        {
+            printf("FAIL: kind %d, %u x %u frames packed to %d bytes\n", kind, width, pages, (int)size);
+            return 1;
+        }
+
+        // box of the changed bytes.
+        oled_delta_area expected = {INT32_MAX, INT32_MIN, INT32_MAX, INT32_MIN};
+        for (uint32_t i = 0; i < total; i++)
+            if (frame[i] != previous[i])
+            {
+                int32_t col = i % width, page = i / width;
+                if (col < expected.col_start) expected.col_start = col;
+                if (col > expected.col_end) expected.col_end = col;
+                if (page < expected.page_start) expected.page_start = page;
+                if (page > expected.page_end) expected.page_end = page;
+            }
+
+        oled_delta_area changed;
+        memcpy(applied, previous, total);
+        if (ssd1306_apply_oled_delta(delta, size, width, pages, applied, width, pages, 0, 0, &changed) != 0 ||
+            memcmp(applied, frame, total) != 0 || memcmp(&changed, &expected, sizeof(changed)) != 0)
+        {
+            printf("FAIL: kind %d, %u x %u frames don't apply back\n", kind, width, pages);
+            return 1;
+        }
+
+        // clipped into a small destination, partly or fully off it.
+        int32_t col = (rand() % (width + 32)) - width;
+        int32_t page = (rand() % (pages + 16)) - pages;
+        for (uint32_t i = 0; i < sizeof(screen); i++)
+            screen[i] = reference[i] = rand();
+        for (int32_t p = 0; p < pages; p++)
+            for (int32_t x = 0; x < width; x++)
+                if (col + x >= 0 && col + x < 16 && page + p >= 0 && page + p < 16)
+                    reference[((page + p) * 16) + col + x] ^= frame[(p * width) + x] ^ previous[(p * width) + x];
+
+        if (ssd1306_apply_oled_delta(delta, size, width, pages, screen, 16, 16, col, page, NULL) != 0 ||
+            memcmp(screen, reference, sizeof(screen)) != 0)
+        {
+            printf("FAIL: kind %d, %u x %u frames applied at %d, %d\n", kind, width, pages, col, page);
+            return 1;
+        }
+
+        // a delta ends inside an XOR run, the trailing unchanged bytes need no token.
+        if (size > 0 && ssd1306_apply_oled_delta(delta, size - 1, width, pages, applied, width, pages, 0, 0, NULL) == 0)
+        {
+            printf("FAIL: kind %d, %u x %u delta applies with its last byte missing\n", kind, width, pages);
+            return 1;
+        }
+    }
+
+    // a 40 x 3 animation of a moving block.
+    memset(frames, 0x00, sizeof(frames));
+    for (int f = 0; f < DELTA_TEST_FRAMES; f++)
+        for (int x = 0; x < 8; x++)
+            frames[f][40 + (f * 2) + x] = 0xFF;
+
+    size_t size = ssd1306_pack_oled_animation(&frames[0][0], DELTA_TEST_FRAMES, 40, 3, animation, sizeof(animation));
+    if (size == 0 || !delta_test_walk(size, sizeof(frames[0])))
+    {
+        printf("FAIL: the animation doesn't walk through its frames\n");
+        return 1;
+    }
+    if (!delta_test_player(size))
+    {
+        printf("FAIL: the player doesn't show the frames with dirty flushes\n");
+        return 1;
+    }
+
+    printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,101 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "ssd1306_oled.h"
+
+// Host test of the span drawn ellipses against a per-pixel reference: a filled ellipse lights exactly
+// the pixels inside the ellipse of radii rx + 1/2, ry + 1/2, its outline exactly those of them with a
+// neighbour ( left, right, up or down ) outside. centers are random, views partly off included, and
+// both colors are drawn.
+
+#define ELLIPSE_TEST_ROUNDS         3000
+#define ELLIPSE_TEST_MAX_RADIUS     40
+
+
+/*!
+    @brief  read a pixel of a view, 0 based.
+    @return 1 when lit, 0 otherwise.
+*/
+static int ellipse_test_pixel(const oled_buffer *view, int x, int y)
+{
+    return (view->oled_user_buffer[1 + ((y / 8) * view->width) + x] >> (y % 8)) & 1;
+}
+
+
+/*!
+    @brief  reference inside test of a pixel.
+    @param  dx
+            column distance from the center.
+    @param  dy
+            row distance from the center.
+    @return 1 when the pixel is inside the ellipse of radii rx + 1/2, ry + 1/2.
+    @note   ( dx / ( rx + 1/2 ) )^2 + ( dy / ( ry + 1/2 ) )^2 <= 1, scaled to integers.
+*/
+static int ellipse_test_inside(int dx, int dy, int rx, int ry)
+{
+    int64_t ax = (int64_t)((2 * rx) + 1) * ((2 * rx) + 1);
+    int64_t by = (int64_t)((2 * ry) + 1) * ((2 * ry) + 1);
+    return (4 * (int64_t)dx * dx * by) + (4 * (int64_t)dy * dy * ax) <= ax * by;
+}
+
+
+/*!
+    @brief  reference pixel of a drawn ellipse.
+    @param  filled
+            1 for a filled ellipse, 0 for its outline.
+    @return 1 when the ellipse covers the pixel.
+*/
+static int ellipse_test_reference(int dx, int dy, int rx, int ry, int filled)
+{
+    if (!ellipse_test_inside(dx, dy, rx, ry))
+        return 0;
+    if (filled)
+        return 1;
+    return !ellipse_test_inside(dx - 1, dy, rx, ry) || !ellipse_test_inside(dx + 1, dy, rx, ry) ||
+           !ellipse_test_inside(dx, dy - 1, rx, ry) || !ellipse_test_inside(dx, dy + 1, rx, ry);
+}
+
+
+int main(void)
+{
+    srand(1);
+
+    for (int round = 0; round < ELLIPSE_TEST_ROUNDS; round++)
+    {
+        int width = 1 + (rand() % OLED_WIDTH);
+        int pages = 1 + (rand() % OLED_PAGES);
+        int height = pages * 8;
+        int rx = rand() % ELLIPSE_TEST_MAX_RADIUS, ry = rand() % ELLIPSE_TEST_MAX_RADIUS;
+        int xc = (rand() % (width + (2 * rx) + 2)) - rx - 1;
+        int yc = (rand() % (height + (2 * ry) + 2)) - ry - 1;
+        int filled = round % 2;
+        uint8_t color = (round / 2) % 2;
+
+        oled_buffer *view = ssd1306_create_viewbox(width, pages);
+        ssd1306_oled_clear_view(view, color ? 0x00 : 0xFF);
+        if (filled)
+            ssd1306_fill_oled_ellipse(view, xc, yc, rx, ry, color);
+        else
+            ssd1306_draw_oled_ellipse(view, xc, yc, rx, ry, color);
+
+        for (int y = 0; y < height; y++)
+            for (int x = 0; x < width; x++)
+            {
+                int expected = ellipse_test_reference(x - xc, y - yc, rx, ry, filled) ? color : !color;
+                if (ellipse_test_pixel(view, x, y) != expected)
+                {
+                    printf("FAIL: %s ellipse %d x %d at %d, %d in a %d x %d view, color %d, pixel %d, %d\n",
+                           filled ? "filled" : "outlined", rx, ry, xc, yc, width, height, color, x, y);
+                    return 1;
+                }
+            }
+        if (view->oled_user_buffer[0] != 0x40)
+        {
+            printf("FAIL: control byte overwritten\n");
+            return 1;
+        }
+        ssd1306_delete_viewbox(view);
+    }
+
+    printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,136 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "ssd1306_oled.h"
+#include "ssd1306_sim.h"
+#include "ssd1306_fonts.h"
+
+// Host test of the flush modes: the same sequence of frames is drawn and flushed with FLUSH_FULL,
+// FLUSH_DIRTY and FLUSH_DIFF. the simulated GDDRAM has to be byte identical after every frame, and
+// the dirty and diff modes have to send fewer data bytes than the full one.
+
+#define FLUSH_TEST_FRAMES           64
+
+static const char *flush_mode_names[3] = {"FLUSH_FULL", "FLUSH_DIRTY", "FLUSH_DIFF"};
+static uint8_t flush_test_screens[3][FLUSH_TEST_FRAMES][OLED_PAGES][OLED_WIDTH];
+
+
+/*!
+    @brief  small deterministic random generator, every mode draws the same sequence.
+    @param  state
+            generator state.
+    @return next value.
+*/
+static uint32_t flush_test_random(uint32_t *state)
+{
+    *state = (*state * 1103515245u) + 12345u;
+    return *state >> 8;
+}
+
+
+/*!
+    @brief  draw one change on a view.
+    @param  view
+            view drawn on.
+    @param  font
+            font for the strings.
+    @param  state
+            generator state.
+    @return None (Void)
+*/
+static void flush_test_draw(oled_buffer *view, font_pack *font, uint32_t *state)
+{
+    int32_t w = view->width, h = view->page * 8;
+    int32_t x = flush_test_random(state) % w, y = flush_test_random(state) % h;
+    uint8_t fill = flush_test_random(state) & 1;
+
+    switch (flush_test_random(state) % 7)
+    {
+    case 0: ssd1306_draw_oled_apixel(view, x, y, fill); break;
+    case 1: ssd1306_draw_oled_line(view, x, y, flush_test_random(state) % w, flush_test_random(state) % h, fill); break;
+    case 2: ssd1306_fill_oled_rect(view, x - 4, y - 4, 1 + (flush_test_random(state) % 20), 1 + (flush_test_random(state) % 12), fill); break;
+    case 3: ssd1306_fill_oled_circle(view, x, y, flush_test_random(state) % 10, fill); break;
+    case 4: ssd1306_draw_oled_string(view, x, "Flush", font, y); break;
+    case 5: ssd1306_rotate_oled_view(view, (int32_t)(flush_test_random(state) % 9) - 4); break;
+    default: break;                     // nothing changes in this frame.
+    }
+}
+
+
+/*!
+    @brief  run the frame sequence with one flush mode.
+    @param  mode
+            flush mode of both views.
+    @param  screens
+            filled with the GDDRAM after every frame.
+    @return data bytes sent for the frames.
+*/
+static uint64_t flush_test_run(flush_mode mode, uint8_t screens[FLUSH_TEST_FRAMES][OLED_PAGES][OLED_WIDTH])
+{
+    static ssd1306_sim sim;
+    ssd1306_sim_init(&sim);
+    ssd1306_transport *transport = ssd1306_create_sim_transport(&sim);
+    ssd1306_init_oled(transport);
+    ssd1306_oled_clear(0);
+
+    font_pack *font = ssd1306_init_oled_font((const uint8_t *)font_5x7, 5, 7, 32);
+    oled_buffer *top = ssd1306_create_viewbox(128, 5);
+    oled_buffer *bottom = ssd1306_create_viewbox(60, 3);
+    ssd1306_place_oled_view(top, 1, 1);
+    ssd1306_place_oled_view(bottom, 31, 6);
+    ssd1306_set_oled_flush_mode(top, mode);
+    ssd1306_set_oled_flush_mode(bottom, mode);
+    ssd1306_send_oled_display_buffer(top);
+    ssd1306_send_oled_display_buffer(bottom);
+    ssd1306_sim_reset_counters(&sim);
+
+    uint32_t state = 1;
+    for (int frame = 0; frame < FLUSH_TEST_FRAMES; frame++)
+    {
+        flush_test_draw(top, font, &state);
+        flush_test_draw(bottom, font, &state);
+        if (frame % 16 == 15)
+            ssd1306_oled_clear_view(top, 0);
+        ssd1306_send_oled_display_buffer(top);
+        ssd1306_send_oled_display_buffer(bottom);
+        memcpy(screens[frame], sim.gddram, sizeof(sim.gddram));
+    }
+
+    uint64_t bytes = sim.data_bytes;
+    ssd1306_delete_viewbox(top);
+    ssd1306_delete_viewbox(bottom);
+    ssd1306_delete_oled_font(font);
+    free(transport);
+    return bytes;
+}
+
+
+int main(void)
+{
+    uint64_t bytes[3];
+    for (int mode = FLUSH_FULL; mode <= FLUSH_DIFF; mode++)
+        bytes[mode] = flush_test_run((flush_mode)mode, flush_test_screens[mode]);
+
+    int failed = 0;
+    for (int mode = FLUSH_DIRTY; mode <= FLUSH_DIFF; mode++)
+    {
+        for (int frame = 0; frame < FLUSH_TEST_FRAMES; frame++)
+            if (memcmp(flush_test_screens[mode][frame], flush_test_screens[FLUSH_FULL][frame], sizeof(flush_test_screens[0][0])) != 0)
+            {
+                printf("%s: frame %d differs from FLUSH_FULL\n", flush_mode_names[mode], frame);
+                failed = 1;
+                break;
+            }
+
+        if (bytes[mode] >= bytes[FLUSH_FULL])
+        {
+            printf("%s: %llu data bytes, not fewer than FLUSH_FULL\n", flush_mode_names[mode], (unsigned long long)bytes[mode]);
+            failed = 1;
+        }
+    }
+
+    printf("data bytes: full %llu, dirty %llu, diff %llu\n",
+           (unsigned long long)bytes[FLUSH_FULL], (unsigned long long)bytes[FLUSH_DIRTY], (unsigned long long)bytes[FLUSH_DIFF]);
+    printf(failed ? "FAIL\n" : "PASS\n");
+    return failed;
+}
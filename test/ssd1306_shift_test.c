@@ -0,0 +1,56 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "ssd1306_oled.h"
+
+// Host test of the word-parallel vertical shift ( ssd1306_shift_oled_view_rows ) against a per-bit
+// reference, over random view sizes ( widths which aren't a multiple of 4 included ) and shifts.
+
+#define SHIFT_TEST_ROUNDS           2000
+
+
+/*!
+    @brief  read a pixel of a view, 0 based.
+    @return 1 when lit, 0 otherwise.
+*/
+static int shift_test_pixel(const oled_buffer *view, int x, int y)
+{
+    return (view->oled_user_buffer[1 + ((y / 8) * view->width) + x] >> (y % 8)) & 1;
+}
+
+
+int main(void)
+{
+    static uint8_t reference[OLED_PAGES * 8][OLED_WIDTH];
+    srand(1);
+
+    for (int round = 0; round < SHIFT_TEST_ROUNDS; round++)
+    {
+        int width = 1 + (rand() % OLED_WIDTH);
+        int pages = 1 + (rand() % OLED_PAGES);
+        int height = pages * 8;
+        int rows = (rand() % (4 * height)) - (2 * height);
+        if (round < 16)
+            rows = round - 8;           // every small shift both ways, 0 included.
+
+        oled_buffer *view = ssd1306_create_viewbox(width, pages);
+        for (uint32_t i = 1; i < view->oled_user_buffer_size; i++)
+            view->oled_user_buffer[i] = rand();
+        for (int y = 0; y < height; y++)
+            for (int x = 0; x < width; x++)
+                reference[y][x] = shift_test_pixel(view, x, y);
+
+        // positive rows move the content to the top, row y shows the old row y + rows.
+        ssd1306_shift_oled_view_rows(view, rows);
+        for (int y = 0; y < height; y++)
+            for (int x = 0; x < width; x++)
+                if (shift_test_pixel(view, x, y) != reference[(((y + rows) % height) + height) % height][x])
+                {
+                    printf("FAIL: width %d, pages %d, rows %d, pixel %d, %d\n", width, pages, rows, x, y);
+                    return 1;
+                }
+        ssd1306_delete_viewbox(view);
+    }
+
+    printf("PASS\n");
+    return 0;
+}
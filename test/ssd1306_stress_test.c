@@ -0,0 +1,264 @@
+#include <stdio.h>
+#include <string.h>
+#include <pthread.h>
+#include <sched.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "ssd1306_oled.h"
+#include "ssd1306_sim.h"
+
+// Host stress test of the tear-free drawing: writer threads redraw their views byte by byte between
+// ssd1306_begin_oled_draw / ssd1306_end_oled_draw while flusher threads and the scroll task send them.
+// every frame of a view is one value in all its bytes ( rotating and rolling keep it uniform ), so any
+// mix of two values in the simulated GDDRAM of a view is a torn frame on the wire. once the writers
+// stopped, one more flush has to leave every view on the screen exactly as its buffer, which catches
+// dirty regions lost between a writer and a flush ( FLUSH_DIRTY ).
+
+#define STRESS_VIEWS                5
+#define STRESS_FLUSHERS             3
+#define STRESS_RUN_MS               1500
+
+// struct for a view under test and its screen area.
+typedef struct
+{
+    oled_buffer *view;
+    uint8_t col;                        // screen position, 0 based
+    uint8_t page;
+    uint16_t width;
+    uint8_t pages;
+    volatile uint32_t frames;           // frames drawn by its writer
+} stress_view;
+
+static ssd1306_sim sim;
+static const ssd1306_transport *sim_transport;
+static stress_view views[STRESS_VIEWS];
+static volatile int running = 1;
+static volatile uint32_t torn_frames = 0;
+static volatile uint32_t checked_flushes = 0;
+static volatile uint32_t dropped_flushes = 0;
+static uint32_t stale_views = 0;
+
+
+/*!
+    @brief  check that the bytes a transaction changed in each view area all have one value.
+    @param  before
+            GDDRAM before the transaction.
+    @return None (Void)
+*/
+static void stress_check_transaction(uint8_t before[OLED_PAGES][OLED_WIDTH])
+{
+    for (int v = 0; v < STRESS_VIEWS; v++)
+    {
+        int seen = -1;
+        for (int page = views[v].page; page < views[v].page + views[v].pages; page++)
+            for (int col = views[v].col; col < views[v].col + views[v].width; col++)
+            {
+                uint8_t now = sim.gddram[page][col];
+                if (now == before[page][col])
+                    continue;
+                if (seen >= 0 && now != seen)
+                {
+                    torn_frames++;
+                    return;
+                }
+                seen = now;
+            }
+    }
+}
+
+
+/*!
+    @brief  data transfer of the test transport, the driver sends it under its flush lock.
+    @return ESP_OK.
+*/
+static esp_err_t stress_transmit_data(void *ctx, const uint8_t *buffer, size_t size)
+{
+    uint8_t before[OLED_PAGES][OLED_WIDTH];
+    memcpy(before, sim.gddram, sizeof(before));
+    sim_transport->transmit_data(ctx, buffer, size);
+    stress_check_transaction(before);
+    return ESP_OK;
+}
+
+
+/*!
+    @brief  asynchronous data transfer of the test transport, finished before it returns.
+    @return ESP_OK.
+*/
+static esp_err_t stress_transmit_data_async(void *ctx, const uint8_t *buffer, size_t size, ssd1306_transfer_done_cb done, void *user_arg)
+{
+    stress_transmit_data(ctx, buffer, size);
+    if (done)
+        done(user_arg);     // no interrupt to yield from on the host.
+    return ESP_OK;
+}
+
+
+/*!
+    @brief  check that the whole area of a view on the simulated screen has one value.
+    @param  view
+            view under test, only flushed by the calling thread.
+    @return None (Void)
+*/
+static void stress_check_view(const stress_view *view)
+{
+    uint8_t value = sim.gddram[view->page][view->col];
+    for (int page = view->page; page < view->page + view->pages; page++)
+        for (int col = view->col; col < view->col + view->width; col++)
+            if (sim.gddram[page][col] != value)
+            {
+                torn_frames++;
+                return;
+            }
+    checked_flushes++;
+}
+
+
+/*!
+    @brief  check that the area of a view on the simulated screen matches the view as it is shown.
+    @param  view
+            view under test, no other thread draws or flushes it anymore.
+    @return None (Void)
+*/
+static void stress_check_final(const stress_view *view)
+{
+    uint8_t row[OLED_WIDTH];
+    for (int page = 0; page < view->pages; page++)
+    {
+        ssd1306_read_oled_view_span(view->view, page, 0, view->width, row);
+        if (memcmp(row, &sim.gddram[view->page + page][view->col], view->width) != 0)
+        {
+            stale_views++;
+            return;
+        }
+    }
+}
+
+
+/*!
+    @brief  redraw a view byte by byte with the next value, yielding in the middle of the frame.
+    @param  arg
+            stress_view pointer.
+    @return NULL.
+*/
+static void *stress_writer(void *arg)
+{
+    stress_view *view = (stress_view *)arg;
+    uint8_t value = 0;
+
+    while (running)
+    {
+        value++;
+        ssd1306_begin_oled_draw(view->view);
+        for (uint32_t i = 1; i < view->view->oled_user_buffer_size; i++)
+        {
+            view->view->oled_user_buffer[i] = value;
+            if (i % 97 == 0)
+                sched_yield();
+        }
+        ssd1306_mark_oled_view_dirty(view->view, 0, view->width - 1, 0, view->pages - 1);
+        ssd1306_end_oled_draw(view->view);
+        view->frames++;
+
+        // a short pause between frames, so flushes also find the view idle.
+        for (int spin = 0; spin < 8; spin++)
+            sched_yield();
+    }
+    return NULL;
+}
+
+
+/*!
+    @brief  flush a view over and over, synchronously and asynchronously by turns.
+    @param  arg
+            stress_view pointer.
+    @return NULL.
+*/
+static void *stress_flusher(void *arg)
+{
+    stress_view *view = (stress_view *)arg;
+    uint32_t round = 0;
+
+    while (running)
+    {
+        if (++round % 2)
+            ssd1306_send_oled_display_buffer(view->view);
+        else if (ssd1306_send_oled_display_buffer_async(view->view, NULL, NULL) != ESP_OK)
+            dropped_flushes++;
+        else
+            ssd1306_wait_oled_flush(view->view);
+        stress_check_view(view);
+    }
+    return NULL;
+}
+
+
+/*!
+    @brief  create a view under test.
+    @return None (Void)
+*/
+static void stress_create_view(stress_view *view, uint16_t width, uint8_t pages, uint8_t col, uint8_t page, flush_mode mode)
+{
+    view->view = ssd1306_create_viewbox(width, pages);
+    ssd1306_place_oled_view(view->view, col + 1, page + 1);
+    ssd1306_set_oled_flush_mode(view->view, mode);
+    view->col = col;
+    view->page = page;
+    view->width = width;
+    view->pages = pages;
+    view->frames = 0;
+}
+
+
+int main(void)
+{
+    ssd1306_sim_init(&sim);
+    sim_transport = ssd1306_create_sim_transport(&sim);
+    static ssd1306_transport transport;
+    transport = *sim_transport;
+    transport.transmit_data = stress_transmit_data;
+    transport.transmit_data_async = stress_transmit_data_async;
+    ssd1306_init_oled(&transport);
+    ssd1306_oled_clear(0);
+
+    // three flushed views side by side, one per flush mode, a horizontally and a vertically scrolled one below them.
+    stress_create_view(&views[0], 48, 4, 0, 0, FLUSH_FULL);
+    stress_create_view(&views[1], 40, 4, 48, 0, FLUSH_DIRTY);
+    stress_create_view(&views[2], 40, 4, 88, 0, FLUSH_DIFF);
+    stress_create_view(&views[3], 128, 2, 0, 4, FLUSH_DIFF);
+    stress_create_view(&views[4], 128, 2, 0, 6, FLUSH_DIRTY);
+    ssd1306_scroll_oled_view_rate(views[3].view, HORIZONTAL_LEFT, 1, 3);
+    ssd1306_scroll_oled_view_rate(views[4].view, VERTICAL_UP, 2, 1);
+
+    pthread_t writers[STRESS_VIEWS], flushers[STRESS_FLUSHERS];
+    for (int v = 0; v < STRESS_VIEWS; v++)
+        pthread_create(&writers[v], NULL, stress_writer, &views[v]);
+    for (int f = 0; f < STRESS_FLUSHERS; f++)
+        pthread_create(&flushers[f], NULL, stress_flusher, &views[f]);
+
+    vTaskDelay(pdMS_TO_TICKS(STRESS_RUN_MS));
+    running = 0;
+    for (int f = 0; f < STRESS_FLUSHERS; f++)
+        pthread_join(flushers[f], NULL);
+    for (int v = 0; v < STRESS_VIEWS; v++)
+        pthread_join(writers[v], NULL);
+    for (int v = STRESS_FLUSHERS; v < STRESS_VIEWS; v++)
+        ssd1306_scroll_stop_oled_view(views[v].view);
+    for (int v = 0; v < STRESS_VIEWS; v++)
+    {
+        ssd1306_send_oled_display_buffer(views[v].view);
+        stress_check_final(&views[v]);
+    }
+
+    printf("frames drawn %u %u %u %u %u, flushes checked %u, async copies dropped %u, data transactions %u, torn frames %u, stale views %u\n",
+           views[0].frames, views[1].frames, views[2].frames, views[3].frames, views[4].frames,
+           checked_flushes, dropped_flushes, sim.data_transactions, torn_frames, stale_views);
+
+    if (torn_frames != 0 || stale_views != 0 || checked_flushes == 0)
+    {
+        printf("FAIL\n");
+        return 1;
+    }
+    printf("PASS\n");
+    return 0;
+}
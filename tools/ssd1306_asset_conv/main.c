@@ -0,0 +1,662 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <ctype.h>
+#include "ssd1306_bitmap_codec.h"
+
+// Host tool turning PBM / PGM / BMP images into page-major ( vertical 1 byte mode ) C arrays for
+// ssd1306_inset_oled_bitmap, ssd1306_blit_oled_bitmap, ssd1306_inset_oled_packed_bitmap and the
+// animation player, so the device never converts images at runtime.
+
+
+// grey image, 0 black to 255 white.
+typedef struct
+{
+    int width;
+    int height;
+    uint8_t *pixels;
+} asset_image;
+
+
+// enum for how grey levels become lit and dark pixels.
+typedef enum
+{
+    DITHER_NONE,                        // threshold
+    DITHER_ORDERED,                     // 8x8 Bayer matrix
+    DITHER_FLOYD                        // Floyd–Steinberg error diffusion
+} asset_dither;
+
+
+// options of the conversion.
+typedef struct
+{
+    const char *name;
+    const char *output;
+    asset_dither dither;
+    int threshold;
+    int invert;
+    int crop_x, crop_y, crop_w, crop_h; // crop_w 0 for no crop
+    int trim;
+    int compress;
+} asset_options;
+
+
+static const uint8_t bayer_8x8[8][8] = {
+    { 0, 32,  8, 40,  2, 34, 10, 42},
+    {48, 16, 56, 24, 50, 18, 58, 26},
+    {12, 44,  4, 36, 14, 46,  6, 38},
+    {60, 28, 52, 20, 62, 30, 54, 22},
+    { 3, 35, 11, 43,  1, 33,  9, 41},
+    {51, 19, 59, 27, 49, 17, 57, 25},
+    {15, 47,  7, 39, 13, 45,  5, 37},
+    {63, 31, 55, 23, 61, 29, 53, 21}
+};
+
+
+/*!
+    @brief  print the usage of the tool.
+    @return None (Void)
+*/
+static void asset_usage(void)
+{
+    fprintf(stderr,
+        "usage: ssd1306_asset_conv [options] image [image ...]\n"
+        "  images are PBM / PGM ( P1 P2 P4 P5 ) or uncompressed BMP ( 1 4 8 24 32 bit ),\n"
+        "  bright pixels are lit, several images make a delta encoded animation.\n"
+        "  -n name        array name ( default bitmap )\n"
+        "  -o file        output file ( default stdout )\n"
+        "  -d mode        none, ordered or floyd dithering ( default none )\n"
+        "  -t level       threshold 0 - 255 without dithering ( default 128 )\n"
+        "  -i             invert, for dark art on a light background\n"
+        "  -c x,y,w,h     crop the images first\n"
+        "  -T             trim the blank margins ( the same box for every image )\n"
+        "  -z             pack the bitmap ( ssd1306_inset_oled_packed_bitmap )\n");
+}
+
+
+/*!
+    @brief  read a whole file.
+    @param  path
+            file path.
+    @param  size
+            filled with the size of the file.
+    @return file content to free, NULL on error.
+*/
+static uint8_t *asset_read_file(const char *path, size_t *size)
+{
+    FILE *file = fopen(path, "rb");
+    if (!file)
+        return NULL;
+
+    fseek(file, 0, SEEK_END);
+    long length = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    uint8_t *data = length > 0 ? malloc(length) : NULL;
+    if (data && fread(data, 1, length, file) != (size_t)length)
+    {
+        free(data);
+        data = NULL;
+    }
+    fclose(file);
+    *size = length > 0 ? (size_t)length : 0;
+    return data;
+}
+
+
+/*!
+    @brief  read the next number of a PNM header or ASCII raster, skipping blanks and comments.
+    @param  data
+            file content.
+    @param  size
+            size of the file.
+    @param  pos
+            position, moved past the number.
+    @return the number, -1 at the end of the file.
+*/
+static long asset_pnm_number(const uint8_t *data, size_t size, size_t *pos)
+{
+    while (*pos < size && (isspace(data[*pos]) || data[*pos] == '#'))
+    {
+        if (data[*pos] == '#')
+            while (*pos < size && data[*pos] != '\n')
+                (*pos)++;
+        else
+            (*pos)++;
+    }
+    if (*pos >= size || !isdigit(data[*pos]))
+        return -1;
+
+    long value = 0;
+    while (*pos < size && isdigit(data[*pos]))
+        value = value * 10 + (data[(*pos)++] - '0');
+    return value;
+}
+
+
+/*!
+    @brief  decode a PBM or PGM image.
+    @param  data
+            file content.
+    @param  size
+            size of the file.
+    @param  image
+            filled with the image.
+    @return 0, or -1 for an unsupported or truncated file.
+*/
+static int asset_load_pnm(const uint8_t *data, size_t size, asset_image *image)
+{
+    char kind = data[1];
+    size_t pos = 2;
+    long width = asset_pnm_number(data, size, &pos);
+    long height = asset_pnm_number(data, size, &pos);
+    long maxval = (kind == '1' || kind == '4') ? 1 : asset_pnm_number(data, size, &pos);
+    if (width <= 0 || height <= 0 || maxval <= 0 || maxval > 65535)
+        return -1;
+
+    image->width = width;
+    image->height = height;
+    image->pixels = malloc(width * height);
+    if (!image->pixels)
+        return -1;
+
+    pos++;                              // the single blank before a binary raster.
+    for (long y = 0; y < height; y++)
+    {
+        for (long x = 0; x < width; x++)
+        {
+            long value;
+            if (kind == '1' || kind == '2')
+            {
+                // P1 digits may be packed together without blanks.
+                if (kind == '1')
+                {
+                    while (pos < size && !isdigit(data[pos]))
+                        pos++;
+                    value = pos < size ? data[pos++] - '0' : -1;
+                }
+                else
+                    value = asset_pnm_number(data, size, &pos);
+            }
+            else if (kind == '4')
+            {
+                size_t byte = pos + (y * ((width + 7) / 8)) + (x / 8);
+                value = byte < size ? (data[byte] >> (7 - (x % 8))) & 1 : -1;
+            }
+            else
+            {
+                size_t depth = maxval > 255 ? 2 : 1;
+                size_t at = pos + ((y * width) + x) * depth;
+                value = at + depth <= size ? (depth == 2 ? (data[at] << 8) | data[at + 1] : data[at]) : -1;
+            }
+            if (value < 0)
+            {
+                free(image->pixels);
+                return -1;
+            }
+
+            // PBM 1 is black.
+            if (kind == '1' || kind == '4')
+                image->pixels[(y * width) + x] = value ? 0 : 255;
+            else
+                image->pixels[(y * width) + x] = (uint8_t)((value * 255) / maxval);
+        }
+    }
+    return 0;
+}
+
+
+/*!
+    @brief  read a little endian value of a BMP file.
+    @param  data
+            first byte.
+    @param  bytes
+            2 or 4.
+    @return value.
+*/
+static uint32_t asset_bmp_value(const uint8_t *data, int bytes)
+{
+    uint32_t value = 0;
+    for (int i = bytes - 1; i >= 0; i--)
+        value = (value << 8) | data[i];
+    return value;
+}
+
+
+/*!
+    @brief  decode an uncompressed BMP image.
+    @param  data
+            file content.
+    @param  size
+            size of the file.
+    @param  image
+            filled with the image.
+    @return 0, or -1 for an unsupported or truncated file.
+*/
+static int asset_load_bmp(const uint8_t *data, size_t size, asset_image *image)
+{
+    if (size < 54)
+        return -1;
+
+    uint32_t offset = asset_bmp_value(&data[10], 4);
+    uint32_t header = asset_bmp_value(&data[14], 4);
+    int32_t width = (int32_t)asset_bmp_value(&data[18], 4);
+    int32_t height = (int32_t)asset_bmp_value(&data[22], 4);
+    int bpp = asset_bmp_value(&data[28], 2);
+    uint32_t compression = asset_bmp_value(&data[30], 4);
+    uint32_t colors = asset_bmp_value(&data[46], 4);
+
+    // BI_BITFIELDS is accepted for 32 bit images in the usual BGRA order.
+    if (width <= 0 || height == 0 || (compression != 0 && !(compression == 3 && bpp == 32)))
+        return -1;
+    if (bpp != 1 && bpp != 4 && bpp != 8 && bpp != 24 && bpp != 32)
+        return -1;
+
+    int top_down = height < 0;
+    if (top_down)
+        height = -height;
+    if (!colors && bpp <= 8)
+        colors = 1u << bpp;
+
+    const uint8_t *palette = &data[14 + header];
+    size_t stride = (((size_t)width * bpp + 31) / 32) * 4;
+    if (offset + (stride * height) > size || (bpp <= 8 && 14 + header + (colors * 4) > size))
+        return -1;
+
+    image->width = width;
+    image->height = height;
+    image->pixels = malloc((size_t)width * height);
+    if (!image->pixels)
+        return -1;
+
+    for (int32_t y = 0; y < height; y++)
+    {
+        const uint8_t *row = &data[offset + (stride * (top_down ? y : height - 1 - y))];
+        for (int32_t x = 0; x < width; x++)
+        {
+            const uint8_t *bgr;
+            if (bpp <= 8)
+            {
+                uint32_t index = bpp == 8 ? row[x] : bpp == 4 ? (row[x / 2] >> (x % 2 ? 0 : 4)) & 0x0F : (row[x / 8] >> (7 - (x % 8))) & 1;
+                if (index >= colors)
+                    index = 0;
+                bgr = &palette[index * 4];
+            }
+            else
+                bgr = &row[x * (bpp / 8)];
+
+            image->pixels[(y * width) + x] = (uint8_t)(((bgr[2] * 299) + (bgr[1] * 587) + (bgr[0] * 114)) / 1000);
+        }
+    }
+    return 0;
+}
+
+
+/*!
+    @brief  load an image file.
+    @param  path
+            file path.
+    @param  image
+            filled with the image.
+    @return 0, or -1 with a message on error.
+*/
+static int asset_load(const char *path, asset_image *image)
+{
+    size_t size;
+    uint8_t *data = asset_read_file(path, &size);
+    int result = -1;
+
+    if (!data || size < 3)
+        fprintf(stderr, "%s: can't read the file\n", path);
+    else if (data[0] == 'P' && strchr("1245", data[1]))
+        result = asset_load_pnm(data, size, image);
+    else if (data[0] == 'B' && data[1] == 'M')
+        result = asset_load_bmp(data, size, image);
+
+    if (data && size >= 3 && result != 0)
+        fprintf(stderr, "%s: unsupported or truncated image\n", path);
+    free(data);
+    return result;
+}
+
+
+/*!
+    @brief  turn a grey image into lit ( 1 ) and dark ( 0 ) pixels.
+    @param  image
+            grey image, cropped already.
+    @param  options
+            conversion options.
+    @return one byte per pixel, NULL if the allocation failed.
+*/
+static uint8_t *asset_binarize(const asset_image *image, const asset_options *options)
+{
+    int width = image->width;
+    int height = image->height;
+    uint8_t *bits = malloc((size_t)width * height);
+    int16_t *error = options->dither == DITHER_FLOYD ? calloc((size_t)width * height, sizeof(int16_t)) : NULL;
+    if (!bits || (options->dither == DITHER_FLOYD && !error))
+    {
+        free(bits);
+        free(error);
+        return NULL;
+    }
+
+    for (int y = 0; y < height; y++)
+    {
+        for (int x = 0; x < width; x++)
+        {
+            int grey = image->pixels[(y * width) + x];
+            if (options->invert)
+                grey = 255 - grey;
+
+            int lit;
+            if (options->dither == DITHER_ORDERED)
+                lit = grey * 64 > (bayer_8x8[y % 8][x % 8] * 256) + 128;
+            else if (options->dither == DITHER_FLOYD)
+            {
+                int value = grey + error[(y * width) + x];
+                lit = value >= 128;
+                int diff = value - (lit ? 255 : 0);
+
+                // 7/16 right, 3/16 down left, 5/16 down, 1/16 down right.
+                if (x + 1 < width) error[(y * width) + x + 1] += (diff * 7) / 16;
+                if (y + 1 < height)
+                {
+                    if (x > 0) error[((y + 1) * width) + x - 1] += (diff * 3) / 16;
+                    error[((y + 1) * width) + x] += (diff * 5) / 16;
+                    if (x + 1 < width) error[((y + 1) * width) + x + 1] += diff / 16;
+                }
+            }
+            else
+                lit = grey >= options->threshold;
+
+            bits[(y * width) + x] = lit;
+        }
+    }
+    free(error);
+    return bits;
+}
+
+
+/*!
+    @brief  crop an image in place.
+    @param  image
+            image.
+    @param  x
+            left column kept.
+    @param  y
+            top row kept.
+    @param  width
+            columns kept.
+    @param  height
+            rows kept.
+    @return 0, or -1 if the box isn't inside the image.
+*/
+static int asset_crop(asset_image *image, int x, int y, int width, int height)
+{
+    if (x < 0 || y < 0 || width <= 0 || height <= 0 || x + width > image->width || y + height > image->height)
+        return -1;
+
+    for (int row = 0; row < height; row++)
+        memmove(&image->pixels[row * width], &image->pixels[((y + row) * image->width) + x], width);
+    image->width = width;
+    image->height = height;
+    return 0;
+}
+
+
+/*!
+    @brief  pack lit pixels into page-major bytes.
+    @param  bits
+            one byte per pixel, lit ( 1 ) or dark ( 0 ).
+    @param  stride
+            pixels per row of bits.
+    @param  x
+            left column of the box packed.
+    @param  y
+            top row of the box packed.
+    @param  width
+            width of the box.
+    @param  height
+            height of the box, the last page is padded with dark rows.
+    @param  out
+            ( height + 7 ) / 8 page rows of width bytes.
+    @return None (Void)
+*/
+static void asset_pack_pages(const uint8_t *bits, int stride, int x, int y, int width, int height, uint8_t *out)
+{
+    int pages = (height + 7) / 8;
+    memset(out, 0, (size_t)width * pages);
+    for (int row = 0; row < height; row++)
+        for (int col = 0; col < width; col++)
+            if (bits[((y + row) * stride) + x + col])
+                out[((row / 8) * width) + col] |= 1 << (row % 8);
+}
+
+
+/*!
+    @brief  write a byte array as C source.
+    @param  output
+            output stream.
+    @param  name
+            array name.
+    @param  data
+            bytes.
+    @param  size
+            number of bytes.
+    @return None (Void)
+*/
+static void asset_write_array(FILE *output, const char *name, const uint8_t *data, size_t size)
+{
+    fprintf(output, "const uint8_t %s [%zu] = {\n", name, size);
+    for (size_t i = 0; i < size; i++)
+    {
+        if (i % 16 == 0)
+            fprintf(output, "    ");
+        fprintf(output, "0x%02X%s", data[i], i + 1 < size ? "," : "");
+        fprintf(output, (i % 16 == 15 || i + 1 == size) ? "\n" : " ");
+    }
+    fprintf(output, "};\n");
+}
+
+
+/*!
+    @brief  parse the command line.
+    @param  argc
+            argument count.
+    @param  argv
+            arguments.
+    @param  options
+            filled with the options.
+    @return index of the first image argument, -1 on a usage error.
+*/
+static int asset_parse(int argc, char **argv, asset_options *options)
+{
+    options->name = "bitmap";
+    options->output = NULL;
+    options->dither = DITHER_NONE;
+    options->threshold = 128;
+    options->invert = 0;
+    options->crop_w = 0;
+    options->trim = 0;
+    options->compress = 0;
+
+    int i = 1;
+    for (; i < argc && argv[i][0] == '-' && argv[i][1]; i++)
+    {
+        const char *flag = argv[i];
+        const char *value = i + 1 < argc ? argv[i + 1] : NULL;
+
+        if (!strcmp(flag, "-i")) options->invert = 1;
+        else if (!strcmp(flag, "-T")) options->trim = 1;
+        else if (!strcmp(flag, "-z")) options->compress = 1;
+        else if (!value) return -1;
+        else if (!strcmp(flag, "-n")) { options->name = value; i++; }
+        else if (!strcmp(flag, "-o")) { options->output = value; i++; }
+        else if (!strcmp(flag, "-t")) { options->threshold = atoi(value); i++; }
+        else if (!strcmp(flag, "-c"))
+        {
+            if (sscanf(value, "%d,%d,%d,%d", &options->crop_x, &options->crop_y, &options->crop_w, &options->crop_h) != 4 || options->crop_w <= 0)
+                return -1;
+            i++;
+        }
+        else if (!strcmp(flag, "-d"))
+        {
+            if (!strcmp(value, "none")) options->dither = DITHER_NONE;
+            else if (!strcmp(value, "ordered")) options->dither = DITHER_ORDERED;
+            else if (!strcmp(value, "floyd")) options->dither = DITHER_FLOYD;
+            else return -1;
+            i++;
+        }
+        else
+            return -1;
+    }
+    return i < argc ? i : -1;
+}
+
+
+int main(int argc, char **argv)
+{
+    asset_options options;
+    int first = asset_parse(argc, argv, &options);
+    if (first < 0)
+    {
+        asset_usage();
+        return 2;
+    }
+
+    int count = argc - first;
+    uint8_t **bits = calloc(count, sizeof(uint8_t *));
+    int width = 0, height = 0;
+    if (!bits)
+    {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+
+    for (int f = 0; f < count; f++)
+    {
+        asset_image image;
+        if (asset_load(argv[first + f], &image) != 0)
+            return 1;
+        if (options.crop_w && asset_crop(&image, options.crop_x, options.crop_y, options.crop_w, options.crop_h) != 0)
+        {
+            fprintf(stderr, "%s: the crop box is outside the image\n", argv[first + f]);
+            free(image.pixels);
+            return 1;
+        }
+        if (f > 0 && (image.width != width || image.height != height))
+        {
+            fprintf(stderr, "%s: the frames of an animation must have the same size\n", argv[first + f]);
+            free(image.pixels);
+            return 1;
+        }
+        width = image.width;
+        height = image.height;
+        bits[f] = asset_binarize(&image, &options);
+        free(image.pixels);
+        if (!bits[f])
+        {
+            fprintf(stderr, "%s: out of memory\n", argv[first + f]);
+            return 1;
+        }
+    }
+
+    // trimming keeps the box of the lit pixels of all the frames.
+    int box_x = 0, box_y = 0, box_w = width, box_h = height;
+    if (options.trim)
+    {
+        int x0 = width, y0 = height, x1 = -1, y1 = -1;
+        for (int f = 0; f < count; f++)
+            for (int y = 0; y < height; y++)
+                for (int x = 0; x < width; x++)
+                    if (bits[f][(y * width) + x])
+                    {
+                        if (x < x0) x0 = x;
+                        if (x > x1) x1 = x;
+                        if (y < y0) y0 = y;
+                        if (y > y1) y1 = y;
+                    }
+        if (x1 < 0)
+        {
+            fprintf(stderr, "nothing is lit, there is nothing to trim to\n");
+            return 1;
+        }
+        box_x = x0;
+        box_y = y0;
+        box_w = x1 - x0 + 1;
+        box_h = y1 - y0 + 1;
+    }
+
+    int pages = (box_h + 7) / 8;
+    if (box_w > 0xFFFF || pages > 0xFF || count > 0xFFFF)
+    {
+        fprintf(stderr, "the image is too large\n");
+        return 1;
+    }
+
+    size_t frame_size = (size_t)box_w * pages;
+    uint8_t *frames = malloc(frame_size * count);
+    if (!frames)
+    {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+    for (int f = 0; f < count; f++)
+        asset_pack_pages(bits[f], width, box_x, box_y, box_w, box_h, &frames[frame_size * f]);
+
+    // the packed forms are at most a little larger than the raw data.
+    size_t capacity = (frame_size * (count + 1) * 2) + 64 + (count * 4);
+    uint8_t *packed = malloc(capacity);
+    if (!packed)
+    {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+    const uint8_t *data = frames;
+    size_t size = frame_size;
+    const char *kind = "page-major bitmap, ssd1306_inset_oled_bitmap / ssd1306_blit_oled_bitmap";
+
+    if (count > 1)
+    {
+        size = ssd1306_pack_oled_animation(frames, count, box_w, pages, packed, capacity);
+        data = packed;
+        kind = "delta encoded animation, ssd1306_create_oled_animation";
+    }
+    else if (options.compress)
+    {
+        size = ssd1306_pack_oled_bitmap(frames, box_w, pages, packed, capacity);
+        data = packed;
+        kind = "packed bitmap, ssd1306_inset_oled_packed_bitmap";
+    }
+    if (!size)
+    {
+        fprintf(stderr, "packing failed\n");
+        return 1;
+    }
+
+    FILE *output = options.output ? fopen(options.output, "w") : stdout;
+    if (!output)
+    {
+        fprintf(stderr, "%s: can't write the file\n", options.output);
+        return 1;
+    }
+
+    fprintf(output, "// %s: %d x %d ( %d pages", options.name, box_w, box_h, pages);
+    if (count > 1)
+        fprintf(output, ", %d frames", count);
+    if (options.trim)
+        fprintf(output, ", trimmed at %d, %d", box_x, box_y);
+    fprintf(output, " ), %s.\n", kind);
+    fprintf(output, "// %zu bytes, %zu raw.\n", size, frame_size * count);
+    asset_write_array(output, options.name, data, size);
+
+    if (output != stdout)
+        fclose(output);
+    for (int f = 0; f < count; f++)
+        free(bits[f]);
+    free(bits);
+    free(frames);
+    free(packed);
+    return 0;
+}